@@ -14,6 +14,14 @@ void Animation_Init(void);
 // 运行一帧动画 (更新位置、碰撞检测、绘制)
 void Animation_Run(void);
 
+// 方块数量上限 (网格粗筛 + 扫掠 AABB，数百个方块也只检查相邻方块)
+#define BOX_MAX 256
+// 设置方块数量并重新生成方块 (边长随数量缩小)
+void Animation_Boxes_SetCount(int count);
+int Animation_Boxes_GetCount(void);
+// 演示中旋转编码器每格增减的方块数
+#define BOX_DEMO_STEP 16
+
 // 初始化3D正方体动画
 void Animation3D_Cube_Init(void);
 // 运行一帧3D正方体动画
@@ -29,6 +37,24 @@ void Animation3D_Sphere_Init(void);
 // 运行一帧3D球体动画
 void Animation3D_Sphere_Run(void);
 
+// 3D 相机：distance 为相机到物体中心的距离 (以模型单位计，模型半径约为 1)
+// distance <= 0 时为正交投影；默认 ANIMATION3D_CAMERA_DISTANCE
+#define ANIMATION3D_CAMERA_DISTANCE 5.0f
+void Animation3D_SetCamera(float distance);
+// 深度提示：靠后的边按深度用抖动线绘制 (越远越淡)，靠前的边为实线
+void Animation3D_SetDepthCue(bool enable);
+// 消隐：按面朝向剔除背面，只绘制正面边与轮廓边 (默认开启)
+void Animation3D_SetHiddenLineRemoval(bool enable);
+// 抗锯齿线框：边以亚像素端点按 MLCD_DrawLineAA (Wu 算法 + Bayer 阈值) 绘制，旋转时不再闪烁 (默认关闭)
+void Animation3D_SetAntiAlias(bool enable);
+
+// 3D 渲染模式
+typedef enum {
+    RENDER3D_WIREFRAME = 0, // 线框
+    RENDER3D_FILLED         // 扫描线填充 + Lambert 平面着色 (Bayer 抖动)
+} Render3DMode_t;
+void Animation3D_SetRenderMode(Render3DMode_t mode);
+
 
 // ----------------------------------------------------------------------------
 // Spring Damper Animation System (二阶阻尼系统)
@@ -68,22 +94,251 @@ void Animation_Spring_SetTarget(SpringAnim_t *anim, float target);
  */
 float Animation_Spring_Update(SpringAnim_t *anim, float dt);
 
+// ----------------------------------------------------------------------------
+// Spring Pool (批量弹簧求解器)
+// 所有弹簧以结构数组 (SoA) 形式存放，一次调用推进全部活动弹簧；
+// 静止的弹簧自动移出活动集合，设置新目标后重新加入
+// ----------------------------------------------------------------------------
+
+// 求解后端：1 = Q16.16 定点 (默认)，0 = float
+#ifndef SPRING_POOL_FIXED
+#define SPRING_POOL_FIXED 1
+#endif
+
+#define SPRING_POOL_SIZE 16     // 最大弹簧数量 (不超过 32)
+#define SPRING_POOL_DT_RES 1024 // 帧间隔量化档 (1/1024 s)：同一档的帧复用参数组缓存的状态转移矩阵
+#define SPRING_INVALID   (-1)
+
+typedef int8_t SpringId_t;
+
+/**
+ * @brief 从弹簧池分配一个弹簧
+ * @param start_val 初始值 (同时作为目标，初始为静止状态)
+ * @param stiffness 刚度
+ * @param damping 阻尼
+ * @return 弹簧句柄，池已满时返回 SPRING_INVALID
+ */
+SpringId_t Animation_SpringPool_Add(float start_val, float stiffness, float damping);
+
+// 释放弹簧
+void Animation_SpringPool_Remove(SpringId_t id);
+
+// 设置新目标 (弹簧重新进入活动集合)
+void Animation_SpringPool_SetTarget(SpringId_t id, float target);
+
+// 修改刚度/阻尼
+void Animation_SpringPool_SetParams(SpringId_t id, float stiffness, float damping);
+
+// 直接跳到指定值并静止 (无动画)
+void Animation_SpringPool_Snap(SpringId_t id, float value);
+
+// 当前位置
+float Animation_SpringPool_GetPosition(SpringId_t id);
+float Animation_SpringPool_GetVelocity(SpringId_t id);
+float Animation_SpringPool_GetTarget(SpringId_t id);
+
+// 弹簧是否仍在运动
+bool Animation_SpringPool_IsActive(SpringId_t id);
+
+// 当前活动弹簧数量
+int Animation_SpringPool_ActiveCount(void);
+
+/**
+ * @brief 推进所有活动弹簧
+ * dt 量化为 1 / SPRING_POOL_DT_RES 秒的整数档 (余量计入下一帧)，每个弹簧按整帧间隔解析推进一次
+ * @param dt 帧间隔 (秒)
+ */
+void Animation_SpringPool_Update(float dt);
+
+// ----------------------------------------------------------------------------
+// Tween Engine (补间动画)
+// 预分配的补间池，每帧由 Animation_Tween_Update 一次推进全部补间；
+// 缓动函数以 Q16.16 定点计算
+// ----------------------------------------------------------------------------
+
+typedef enum {
+    EASE_LINEAR = 0,
+    EASE_IN_QUAD,
+    EASE_OUT_QUAD,
+    EASE_IN_OUT_QUAD,
+    EASE_IN_CUBIC,
+    EASE_OUT_CUBIC,
+    EASE_IN_OUT_CUBIC,
+    EASE_OUT_BACK,      // 末端轻微超调
+    EASE_OUT_BOUNCE,    // 末端弹跳
+    EASE_COUNT
+} Easing_t;
+
+#define TWEEN_POOL_SIZE 24
+#define TWEEN_INVALID   (-1)
+
+typedef int16_t TweenId_t;  // 低 8 位为槽位，高位为代号 (槽位复用后旧句柄自动失效)
+typedef void (*TweenCallback_t)(void *user);
+
+/**
+ * @brief 计算缓动曲线 (Q16.16 定点)
+ * @param t 进度 0 ~ 65536
+ * @return 缓动后的进度 (EASE_OUT_BACK 会略超过 65536)
+ */
+int32_t Animation_Ease(Easing_t ease, int32_t t);
+
+/**
+ * @brief 启动补间：在 delay 秒后，用 duration 秒把 *value 从 from 变化到 to
+ * 启动时 *value 立即设为 from
+ * @return 补间句柄，池已满时返回 TWEEN_INVALID (此时 *value 直接设为 to)
+ */
+TweenId_t Animation_Tween_Start(float *value, float from, float to, float duration, float delay, Easing_t ease);
+
+/**
+ * @brief 交错序列：values[i] 的补间延迟 i * stagger 秒启动，总时长 (count - 1) * stagger + duration
+ * @return 最后一个补间的句柄 (可用于挂接整个序列的完成回调)；
+ *         池中空闲槽位少于 count 时不启动任何补间，values 全部设为 to 并返回 TWEEN_INVALID
+ */
+TweenId_t Animation_Tween_Stagger(float *values, int count, float from, float to,
+                                  float duration, float stagger, Easing_t ease);
+
+// 设置完成回调 (补间正常结束时调用一次)
+void Animation_Tween_OnComplete(TweenId_t id, TweenCallback_t callback, void *user);
+
+// 停止补间；jump_to_end 为 true 时把数值设为终值并触发完成回调
+void Animation_Tween_Stop(TweenId_t id, bool jump_to_end);
+
+// 停止所有驱动 value 的补间 (重新启动同一动画前调用)
+void Animation_Tween_StopValue(float *value);
+
+bool Animation_Tween_IsActive(TweenId_t id);
+
+// 推进所有补间 (每帧调用一次)
+void Animation_Tween_Update(float dt);
+
+// ----------------------------------------------------------------------------
+// Sprite Player (帧序列播放)
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    const MLCD_Sprite_t *sprite;
+    uint8_t *frame_buf;  // 差分帧解码缓冲 (stride * h 字节)，仅含关键帧的序列可为 NULL
+    float time;          // 当前帧已显示时间 (秒)
+    uint16_t frame;      // 当前帧号
+    int16_t decoded;     // frame_buf 中已解码的帧号 (-1 = 无效)
+    bool loop;           // 播放到末尾后回到第 0 帧
+    bool playing;
+} SpritePlayer_t;
+
+/**
+ * @brief 初始化帧序列播放器
+ * @param frame_buf 解码缓冲，sprite->has_delta 时必须提供 (stride * h 字节)
+ */
+void Animation_Sprite_Init(SpritePlayer_t *player, const MLCD_Sprite_t *sprite, uint8_t *frame_buf, bool loop);
+
+/**
+ * @brief 按时间推进帧 (一次更新可跨越多帧，帧率与刷新率无关)
+ * @param dt 时间步长 (秒)
+ * @return 是否仍在播放
+ */
+bool Animation_Sprite_Update(SpritePlayer_t *player, float dt);
+
+// 跳转到指定帧
+void Animation_Sprite_Seek(SpritePlayer_t *player, uint16_t frame);
+
+// 绘制当前帧 (带透明掩码)
+void Animation_Sprite_Draw(SpritePlayer_t *player, int x, int y, uint8_t color);
+
+// 帧序列演示 (加载动画)
+void Animation_SpriteDemo_Init(void);
+void Animation_SpriteDemo_Run(void);
+
+// ----------------------------------------------------------------------------
+// Particle System (粒子系统)
+// 粒子以结构数组 (SoA) 存放在静态池中，按固定步频做 Q8.8 定点积分；
+// 与矩形碰撞体的碰撞通过均匀网格粗筛，每个粒子只检查所在网格单元内的矩形
+// ----------------------------------------------------------------------------
+
+#define PARTICLE_MAX         2048  // 粒子池容量 (每个粒子 9 字节)
+#define PARTICLE_FRAC_BITS   8     // 位置/速度的小数位 (Q8.8，位置范围 -128 ~ 127.996 像素)
+#define PARTICLE_ONE         (1 << PARTICLE_FRAC_BITS)
+#define PARTICLE_MAX_COLLIDERS 64  // 碰撞矩形上限
+#define PARTICLE_GRID_SHIFT  3     // 网格单元 8x8 像素
+
+// 碰撞矩形 (像素)
+typedef struct {
+    int16_t x, y, w, h;
+} ParticleCollider_t;
+
+// 清空粒子池
+void Animation_Particles_Clear(void);
+
+/**
+ * @brief 发射粒子
+ * @param x,y 发射位置 (像素)
+ * @param vx,vy 初速度 (像素/步)，每个粒子在各轴上附加 ±spread 的随机量
+ * @param life 寿命 (步，1~255)，每个粒子随机缩短最多 1/4
+ * @return 实际发射数 (池满时少于 count)
+ */
+int Animation_Particles_Emit(int count, float x, float y, float vx, float vy, float spread, uint8_t life);
+
+// 重力加速度 (像素/步²，向下为正) 与碰撞恢复系数 (0~1)
+void Animation_Particles_SetPhysics(float gravity, float restitution);
+
+// 设置碰撞矩形并重建网格 (碰撞体移动后需重新调用)
+void Animation_Particles_SetColliders(const ParticleCollider_t *rects, int count);
+
+// 推进一步 (积分、边界与碰撞体反弹、回收寿命耗尽的粒子)
+void Animation_Particles_Step(void);
+
+// 绘制所有粒子 (单像素点)
+void Animation_Particles_Draw(uint8_t color);
+
+// 当前粒子数
+int Animation_Particles_Count(void);
+
+// 粒子演示：喷泉粒子落在弹跳方块上，屏幕显示粒子数与模拟+绘制耗时
+void Animation_ParticleDemo_Init(void);
+void Animation_ParticleDemo_Run(void);
+// 调整演示的目标粒子数 (每格 PARTICLE_DEMO_STEP 个)
+#define PARTICLE_DEMO_STEP 256
+void Animation_ParticleDemo_Adjust(int delta);
+
 // ----------------------------------------------------------------------------
 // Page Transition System (页面切换过渡)
 // ----------------------------------------------------------------------------
 
+// 过渡效果类型
+typedef enum {
+    TRANSITION_DISSOLVE = 0, // Bayer 抖动溶解 (默认)
+    TRANSITION_SLIDE,        // 水平滑动 (进入时新页面从右侧推入，返回时从左侧)
+    TRANSITION_PUSH,         // 垂直推入 (进入时从下方，返回时从上方)
+    TRANSITION_IRIS,         // 圆形光圈从中心展开
+    TRANSITION_BLINDS,       // 百叶窗
+    TRANSITION_COUNT
+} TransitionType_t;
+
+// 过渡方向 (影响滑动/推入方向)
+typedef enum {
+    TRANSITION_DIR_FORWARD = 0, // 进入下一级
+    TRANSITION_DIR_BACKWARD     // 返回上一级
+} TransitionDir_t;
+
 // 设置过渡动画时长 (秒)
 void Animation_SetTransitionDuration(float duration);
 
-// 开始页面切换过渡 (捕获当前屏幕)
+// 设置/获取过渡效果
+void Animation_SetTransitionType(TransitionType_t type);
+TransitionType_t Animation_GetTransitionType(void);
+
+// 开始页面切换过渡 (捕获当前屏幕，方向为 FORWARD)
 void Animation_Transition_Start(void);
 
+// 开始指定方向的页面切换过渡
+void Animation_Transition_StartDir(TransitionDir_t dir);
+
 // 更新过渡动画状态
 // @param dt 时间步长
 // @return true if transitioning, false if done
 bool Animation_Transition_Update(float dt);
 
-// 应用过渡效果到显存 (在每一帧绘制完成后调用)
+// 应用过渡效果 (在每一帧绘制完成后、MLCD_Refresh 之前调用)
+// 显存保持为新页面，合成在下一次 MLCD_Refresh 组包时逐行进行
 void Animation_Transition_Apply(void);
 
 // 检查是否正在进行过渡
@@ -0,0 +1,57 @@
+//
+// 快速数学：查表 sin/cos、定点角度与快速倒数/平方根
+//
+
+#ifndef MLCD_DRIVER_FASTMATH_H
+#define MLCD_DRIVER_FASTMATH_H
+
+#include <stdint.h>
+
+// 查表三角函数：1/4 周期 FASTMATH_SIN_STEPS 段正弦表 (Q15)，段内线性插值
+// |rad| <= 10 时最大绝对误差约 7e-5 (Q15 量化 + 浮点相位舍入)，在 128px 屏幕上远小于 1 像素
+#define FASTMATH_SIN_STEPS 256
+
+// 定点角度：一整圈 = FASTMATH_TURN (与 Q16 相同的刻度，便于在定点代码中累加与回绕)
+#define FASTMATH_TURN 65536
+
+// Q16.16 定点数
+#define FASTMATH_Q16_ONE 65536
+#define FASTMATH_Q16(f)  ((int32_t)((f) * 65536.0f))
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Q16 乘法 (64 位中间结果，结果截断)
+static inline int32_t FastMath_MulQ16(int32_t a, int32_t b) {
+    return (int32_t)(((int64_t)a * b) >> 16);
+}
+
+// Q16 除法 (b 为 0 时返回带符号的最大值)
+static inline int32_t FastMath_DivQ16(int32_t a, int32_t b) {
+    if (b == 0) return (a >= 0) ? INT32_MAX : -INT32_MAX;
+    return (int32_t)(((int64_t)a << 16) / b);
+}
+
+// 正弦/余弦 (弧度)：已验证范围 |rad| <= 1e3，最大绝对误差约 1.3e-4
+// 更大的角度受 float 相位精度限制，误差随角度增长 (1e4 约 8e-4，1e7 时结果已不可用)，持续累加的角度应用 FastMath_WrapAngle 回绕
+float FastMath_Sin(float rad);
+float FastMath_Cos(float rad);
+// 同时计算正弦与余弦 (共用一次取模)
+void FastMath_SinCos(float rad, float *s, float *c);
+
+// 把角度回绕到 [-π, π) (持续累加的角度每帧回绕一次，保持在正弦/余弦的验证范围内)
+float FastMath_WrapAngle(float rad);
+
+// 定点正弦/余弦：角度为 FASTMATH_TURN 刻度 (超出一圈自动回绕)，结果为 Q16
+int32_t FastMath_SinQ16(uint32_t angle);
+int32_t FastMath_CosQ16(uint32_t angle);
+
+// 快速倒数 1/x (x > 0；指数取反初值 + 两次牛顿迭代，相对误差 < 1e-5)
+float FastMath_Recip(float x);
+
+// 快速平方根 (x <= 0 返回 0)
+// 有 FPU 时直接使用 VSQRT 指令 (不经过 libm 的 errno 处理)，否则为倒数平方根 + 三次牛顿迭代，相对误差 < 1e-6
+float FastMath_Sqrt(float x);
+
+#endif //MLCD_DRIVER_FASTMATH_H
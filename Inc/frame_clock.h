@@ -0,0 +1,44 @@
+//
+// 帧时钟：DWT 周期计数器计时，提供帧间隔 dt、帧率与帧时间直方图
+//
+
+#ifndef MLCD_DRIVER_FRAME_CLOCK_H
+#define MLCD_DRIVER_FRAME_CLOCK_H
+
+#include "main.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// 帧时间直方图：FRAME_CLOCK_HIST_BINS 个桶，每桶 FRAME_CLOCK_HIST_BIN_US 微秒，最后一桶收集所有更长的帧
+#define FRAME_CLOCK_HIST_BINS   16
+#define FRAME_CLOCK_HIST_BIN_US 2000
+
+// 单帧 dt 上限 (秒)：调试暂停或长时间阻塞后避免动画一步跳到底
+#define FRAME_CLOCK_MAX_DT      0.25f
+
+// 初始化帧时钟 (启用 DWT 周期计数器，需在 SystemClock_Config 之后调用)
+void FrameClock_Init(void);
+
+// 标记新的一帧开始 (每帧调用一次，通常在 Menu_Loop 开头)
+// @return 本帧 dt (秒)
+float FrameClock_Tick(void);
+
+// 本帧 dt (秒)，供所有动画使用
+float FrameClock_GetDt(void);
+
+// 上一帧实际耗时 (us)
+uint32_t FrameClock_GetFrameUs(void);
+
+// 平滑后的帧率 (指数滑动平均)
+int FrameClock_GetFPS(void);
+
+// 当前时间 (us，32 位回绕)，可用于代码段计时
+uint32_t FrameClock_Micros(void);
+
+// 帧时间直方图 (FRAME_CLOCK_HIST_BINS 个计数)
+const uint32_t* FrameClock_GetHistogram(void);
+
+// 清空直方图
+void FrameClock_ResetStats(void);
+
+#endif //MLCD_DRIVER_FRAME_CLOCK_H
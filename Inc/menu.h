@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "mlcd.h"
 
 // 菜单项类型
 typedef enum {
@@ -45,8 +46,8 @@ typedef struct MenuItem {
     // 链表指针
     struct MenuItem *next;
     
-    // 图标数据 (32x32 bitmap, optional)
-    const uint8_t *icon;
+    // 图标资源 (tools/assetgen.py 生成, optional)
+    const MLCD_Asset_t *icon;
     
 } MenuItem_t;
 
@@ -74,8 +75,8 @@ typedef struct MenuPage {
 
 #include "animation.h"
 
-// 暴露光标动画对象，以便外部可以修改其参数 (如阻尼)
-extern SpringAnim_t cursor_anim;
+// 暴露光标动画弹簧句柄，以便外部可以修改其参数 (如阻尼)
+extern SpringId_t cursor_spring;
 
 // 暴露全局深色模式设置，供 menu.c 渲染时使用
 extern bool setting_dark_mode;
@@ -109,7 +110,7 @@ void Menu_SetLayout(MenuPage_t *page, MenuLayout_t layout);
 MenuItem_t* Menu_AddAction(MenuPage_t *page, const char *label, MenuCallback_t callback, void *data);
 
 // 设置菜单项图标
-void Menu_SetItemIcon(MenuItem_t *item, const uint8_t *icon);
+void Menu_SetItemIcon(MenuItem_t *item, const MLCD_Asset_t *icon);
 
 // 添加开关项
 MenuItem_t* Menu_AddToggle(MenuPage_t *page, const char *label, bool *val_ptr, MenuCallback_t callback);
@@ -0,0 +1,68 @@
+//
+// Flash 网格格式 (tools/meshgen.py 生成，见 mesh_assets.c)
+//
+
+#ifndef MLCD_DRIVER_MESH_H
+#define MLCD_DRIVER_MESH_H
+
+#include <stdint.h>
+
+// 网格格式标志
+#define MESH_VERT16  0x01 // 顶点为 int16 (否则 int8)
+#define MESH_INDEX16 0x02 // 索引为 uint16 (否则 uint8)
+
+// 量化单位：坐标 = 存储值 / 单位，网格已缩放到 [-1, 1]
+#define MESH_UNIT8   127
+#define MESH_UNIT16  32767
+#define MESH_NORMAL_UNIT 127
+
+// 无效索引 (三角形的第 4 个顶点、缺失的相邻面)，按索引宽度取全 1
+#define MESH_NONE8   0xFF
+#define MESH_NONE16  0xFFFF
+
+/**
+ * 存放在 Flash 中的只读网格 (由 tools/meshgen.py 从 OBJ 生成)
+ * vertices: vertex_count * 3 个量化坐标 (x, y, z)，屏幕坐标系：y 向下，z 指向屏幕内
+ * normals:  face_count * 3 个 int8 朝外单位法线 (单位 MESH_NORMAL_UNIT)
+ * edges:    edge_count * 4 个索引 (a, b, 相邻面 0, 相邻面 1)
+ * faces:    face_count * 4 个索引，从外侧看为逆时针；三角形第 4 个索引为 MESH_NONE
+ * 没有面的网格 (纯线框) 的 normals/faces 为 NULL
+ */
+typedef struct {
+    const void *vertices;
+    const int8_t *normals;
+    const void *edges;
+    const void *faces;
+    uint16_t vertex_count;
+    uint16_t edge_count;
+    uint16_t face_count;
+    uint8_t flags;
+} Mesh_t;
+
+// 读取索引表 list 的第 i 项，MESH_NONE 返回 -1
+static inline int Mesh_Index(const Mesh_t *mesh, const void *list, int i) {
+    if (mesh->flags & MESH_INDEX16) {
+        uint16_t v = ((const uint16_t *)list)[i];
+        return (v == MESH_NONE16) ? -1 : v;
+    }
+    uint8_t v = ((const uint8_t *)list)[i];
+    return (v == MESH_NONE8) ? -1 : v;
+}
+
+// 读取第 i 个顶点的量化坐标
+static inline void Mesh_Vertex(const Mesh_t *mesh, int i, int32_t *x, int32_t *y, int32_t *z) {
+    if (mesh->flags & MESH_VERT16) {
+        const int16_t *v = (const int16_t *)mesh->vertices + i * 3;
+        *x = v[0]; *y = v[1]; *z = v[2];
+    } else {
+        const int8_t *v = (const int8_t *)mesh->vertices + i * 3;
+        *x = v[0]; *y = v[1]; *z = v[2];
+    }
+}
+
+// 顶点量化单位
+static inline float Mesh_Unit(const Mesh_t *mesh) {
+    return (mesh->flags & MESH_VERT16) ? (float)MESH_UNIT16 : (float)MESH_UNIT8;
+}
+
+#endif //MLCD_DRIVER_MESH_H
@@ -0,0 +1,32 @@
+//
+// Generated by tools/meshgen.py - do not edit.
+// Source: assets/meshes/
+//
+
+#ifndef MLCD_DRIVER_MESH_ASSETS_H
+#define MLCD_DRIVER_MESH_ASSETS_H
+
+#include "mesh.h"
+
+#define MESH_CUBE_VERTICES 8
+#define MESH_CUBE_EDGES    12
+#define MESH_CUBE_FACES    6
+extern const Mesh_t mesh_cube;
+
+#define MESH_PYRAMID_VERTICES 4
+#define MESH_PYRAMID_EDGES    6
+#define MESH_PYRAMID_FACES    4
+extern const Mesh_t mesh_pyramid;
+
+#define MESH_SPHERE_VERTICES 98
+#define MESH_SPHERE_EDGES    204
+#define MESH_SPHERE_FACES    108
+extern const Mesh_t mesh_sphere;
+
+// Largest mesh (renderer scratch buffer sizes)
+#define MESH_MAX_VERTICES 98
+#define MESH_MAX_FACES    108
+
+// Mesh data: 2044 bytes
+
+#endif //MLCD_DRIVER_MESH_ASSETS_H
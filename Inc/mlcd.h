@@ -15,6 +15,9 @@
 #define MLCD_COLOR_WHITE 1
 #define MLCD_COLOR_BLACK 0
 
+// 屏幕空间有序抖动共用的 4x4 Bayer 矩阵 (0~15)，按 [y % 4][x % 4] 取阈值 (抖动线、抗锯齿线、抗锯齿字体)
+extern const uint8_t mlcd_bayer4x4[4][4];
+
 // 函数声明
 void MLCD_Init(void);
 void MLCD_Clear(void);        // 清除屏幕和显存 (硬件清屏)
@@ -23,8 +26,19 @@ void MLCD_Fill(uint8_t color); // 填充显存
 void MLCD_SetPixel(int x, int y, uint8_t color);
 void MLCD_DrawPixel(int x, int y, uint8_t color); // 像素绘制 (Alias for SetPixel)
 void MLCD_DrawLine(int x0, int y0, int x1, int y1, uint8_t color);
+// 抖动线：按 4x4 Bayer 矩阵只绘制 density/16 的像素 (density 0~16，16 等同于实线)，用于深度提示等
+void MLCD_DrawLineDither(int x0, int y0, int x1, int y1, uint8_t color, uint8_t density);
+// 抗锯齿线 (Wu 算法 + Bayer 阈值)：端点为 1/MLCD_SUBPIXEL 像素定点坐标，像素 (x, y) 的中心为 (x + 0.5, y + 0.5)
+// 每个主轴步上下两个像素按覆盖率 * density/16 与屏幕空间 Bayer 阈值比较决定亮灭，移动时不会闪烁
+#define MLCD_SUBPIXEL_BITS 4
+#define MLCD_SUBPIXEL      (1 << MLCD_SUBPIXEL_BITS)
+void MLCD_DrawLineAA(int x0, int y0, int x1, int y1, uint8_t color, uint8_t density);
+// 批量画点：坐标为 frac_bits 位小数的定点数 (结构数组布局)，逐点直接写显存字节，自动裁剪
+void MLCD_DrawPoints(const int16_t *xs, const int16_t *ys, int count, int frac_bits, uint8_t color);
 void MLCD_DrawRect(int x, int y, int w, int h, uint8_t color); // 矩形绘制
 void MLCD_FillRect(int x, int y, int w, int h, uint8_t color); // 填充矩形
+// 水平跨度填充：第 y 行 [x0, x1] 范围按 pattern 写入 (显存位序的 8 像素图案，0xFF 白 / 0x00 黑)，自动裁剪
+void MLCD_FillSpan(int y, int x0, int x1, uint8_t pattern);
 void MLCD_DrawCircle(int x0, int y0, int r, uint8_t color); // 画圆
 void MLCD_FillCircle(int x0, int y0, int r, uint8_t color); // 填充圆
 void MLCD_DrawRoundRect(int x, int y, int w, int h, int r, uint8_t color); // 画圆角矩形
@@ -41,11 +55,144 @@ void MLCD_DrawChar(uint8_t x, uint8_t y, char c, uint8_t color);
 void MLCD_DrawCharBold(uint8_t x, uint8_t y, char c, uint8_t color);
 void MLCD_DrawString(uint8_t x, uint8_t y, const char *str, uint8_t color);
 void MLCD_DrawStringBold(uint8_t x, uint8_t y, const char *str, uint8_t color);
-void MLCD_DrawBitmap(int x, int y, int w, int h, const uint8_t *bitmap, uint8_t color); // 绘制位图
+
+// 文本度量与排版 (5x7 字体，字符步进 6px = 5 + 1 间距)
+#define MLCD_FONT_WIDTH   5
+#define MLCD_FONT_HEIGHT  7
+#define MLCD_FONT_ADVANCE 6
+
+typedef enum {
+    MLCD_ALIGN_LEFT = 0,
+    MLCD_ALIGN_CENTER,
+    MLCD_ALIGN_RIGHT
+} MLCD_Align_t;
+
+// 测量字符串宽度 (像素)。按字符串指针缓存，仅用于内容不变的字符串 (字面量/常量标签)
+int MLCD_MeasureText(const char *str);
+// 测量前 len 个字符的宽度 (不缓存，用于 sprintf 等动态缓冲区)
+int MLCD_MeasureTextN(const char *str, int len);
+// 清空宽度缓存 (常量字符串被替换内容后调用)
+void MLCD_InvalidateTextCache(void);
+// 在 [x, x+w) 区域内按对齐方式绘制字符串，超宽时截断并以省略号结尾
+void MLCD_DrawStringAligned(int x, int y, int w, const char *str, MLCD_Align_t align, uint8_t color);
+// 同上，用于动态缓冲区 (长度由调用者给出，不走缓存)
+void MLCD_DrawStringAlignedN(int x, int y, int w, const char *str, int len, MLCD_Align_t align, uint8_t color);
+
+// 数值格式化 (可重入、不分配内存，替代 sprintf)
+#define MLCD_FMT_SIGN 0x01 // 正数也显示 '+'
+#define MLCD_FMT_ZERO 0x02 // 宽度不足时补 '0' (默认补空格)
+
+// 格式化定点数: val / 10^decimals，最小宽度 width (不含单位)，末尾追加单位 unit (可为 NULL)
+// @return 写入的字符数 (不含 '\0')；缓冲区不足时返回 0 并写入空串
+int MLCD_FormatNumber(char *buf, int size, int32_t val, int decimals, int width, uint8_t flags, const char *unit);
+// 格式化整数 (等价于 "%ld")
+int MLCD_FormatInt(char *buf, int size, int32_t val);
+
+// 将字符串预渲染为显存位序的离屏位图 (MLCD_FONT_HEIGHT 行，每行 stride 字节)
+// @return 渲染宽度 (像素)，超出 stride * 8 的部分被截断
+int MLCD_RenderText(uint8_t *dst, int stride, const char *str, int len);
+
+// 紧凑字形格式 (tools/fontgen.py 生成的抗锯齿字体)
+// 字形按行存储每像素 4 bit 的覆盖率 (0 = 空，15 = 全覆盖，低半字节在左)，每行 (w + 1) / 2 字节，裁剪到笔画包围盒
+typedef struct {
+    uint16_t offset;  // 在 bitmap 中的字节偏移
+    uint8_t w, h;     // 位图尺寸 (px)
+    int8_t x_ofs;     // 相对笔位置的水平偏移
+    int8_t y_ofs;     // 相对行顶部的垂直偏移
+    uint8_t advance;  // 笔位置步进 (px)
+} MLCD_Glyph_t;
+
+typedef struct {
+    const uint8_t *bitmap;
+    const MLCD_Glyph_t *glyphs;
+    uint8_t first;    // 首字符
+    uint8_t last;     // 末字符
+    uint8_t height;   // 行高 (px)
+} MLCD_FontDesc_t;
+
+// 图片数据编码方式
+typedef enum {
+    MLCD_ENC_RAW = 0,  // 未压缩，每行 stride 字节
+    MLCD_ENC_RLE       // 行优先逐像素游程编码 (黑白交替，4bit 半字节长度，15 表示续接)
+} MLCD_Encoding_t;
+
+// 图片资源 (tools/assetgen.py 生成，显存位序，行优先，1 = 笔画)
+typedef struct {
+    const uint8_t *data;
+    uint8_t w, h;     // 尺寸 (px)
+    uint8_t stride;   // 每行字节数 (解码后)
+    uint8_t encoding; // MLCD_Encoding_t
+} MLCD_Bitmap_t;
+
+typedef struct {
+    MLCD_Bitmap_t base;           // 原始尺寸
+    const MLCD_Bitmap_t *scaled;  // 预缩放版本，宽度连续递增 (可为 NULL)
+    uint8_t scaled_count;
+} MLCD_Asset_t;
+
+// 帧序列 (精灵表，tools/assetgen.py --sprites 生成)
+#define MLCD_FRAME_DELTA 0x01  // 帧数据为与上一帧的 XOR 差分，否则为关键帧
+
+typedef struct {
+    MLCD_Bitmap_t image;          // 关键帧图像或差分数据
+    const MLCD_Bitmap_t *mask;    // 透明掩码 (1 = 不透明)，NULL 表示只绘制笔画像素
+    uint8_t flags;                // MLCD_FRAME_*
+} MLCD_Frame_t;
+
+typedef struct {
+    const MLCD_Frame_t *frames;   // 第 0 帧必为关键帧
+    uint16_t frame_count;
+    uint16_t frame_ms;            // 每帧时长 (ms)
+    uint8_t w, h, stride;
+    uint8_t has_delta;            // 含差分帧时播放需要 stride * h 字节的解码缓冲
+} MLCD_Sprite_t;
+
+// 绘制图片资源 (直接 Blit，无需位序转换；压缩数据逐行流式解码，宽度不超过 MLCD_WIDTH)
+void MLCD_DrawImage(int x, int y, const MLCD_Bitmap_t *bmp, uint8_t color);
+// 带透明掩码绘制：mask 为 1 的像素按 img 写入 (笔画 = color，其余 = 反色)，mask 为 0 处保持不变
+// mask 为 NULL 时等同于 MLCD_DrawImage
+void MLCD_DrawImageMasked(int x, int y, const MLCD_Bitmap_t *img, const MLCD_Bitmap_t *mask, uint8_t color);
+
+#define MLCD_UNPACK_COPY 0  // 解码结果覆盖 dst
+#define MLCD_UNPACK_XOR  1  // 解码结果异或到 dst (差分帧)
+// 将图片解码到 dst (stride * h 字节，显存位序)
+void MLCD_UnpackImage(const MLCD_Bitmap_t *bmp, uint8_t *dst, uint8_t mode);
+// 获取宽度为 w 的预缩放版本；没有精确匹配时返回宽度最接近的版本
+const MLCD_Bitmap_t* MLCD_AssetGetSize(const MLCD_Asset_t *asset, int w);
+
+// 使用紧凑字形字体绘制字符串 (覆盖率按屏幕坐标的 Bayer 阈值抖动)，超过 w 时截断并补省略号，返回绘制宽度
+int MLCD_DrawStringFont(int x, int y, int w, const MLCD_FontDesc_t *font, const char *str, uint8_t color);
+// 测量紧凑字形字体下的字符串宽度
+int MLCD_MeasureTextFont(const MLCD_FontDesc_t *font, const char *str);
+void MLCD_DrawBitmap(int x, int y, int w, int h, const uint8_t *bitmap, uint8_t color); // 绘制位图 (旧格式: 行优先, MSB 在左)
 void MLCD_DrawBitmapScaled(int x, int y, int w, int h, const uint8_t *bitmap, float scale, uint8_t color); // 缩放绘制位图
 void MLCD_InvertRect(int x, int y, int w, int h); // 反色区域
+
+// 位块传输：src 为显存位序 (bit0 = 最左像素) 的 1bpp 掩码，位为 1 处以 color 绘制
+// 从 src 的第 src_x 列开始取 w 列，按字节移位拼接写入显存 (支持亚字节偏移与裁剪)
+void MLCD_BlitMask(int x, int y, int w, int h, const uint8_t *src, int src_stride, int src_x, uint8_t color);
 void MLCD_Refresh(void);     // 刷新显存到屏幕
 
+// 局部刷新：记录已发送的画面，只发送内容变化的行 (额外占用一帧大小的 RAM)
+#ifndef MLCD_PARTIAL_REFRESH
+#define MLCD_PARTIAL_REFRESH 1
+#endif
+// 局部刷新时每隔多少次刷新强制发送全部行，防止屏幕与显存失步 (0 = 不强制)
+#ifndef MLCD_FULL_REFRESH_INTERVAL
+#define MLCD_FULL_REFRESH_INTERVAL 60
+#endif
+// 下一次 MLCD_Refresh 发送全部行 (屏幕内容被绕过显存修改后调用)
+void MLCD_ForceFullRefresh(void);
+
+// 行合成回调：MLCD_Refresh 组包时调用，将第 y 行的输出 (MLCD_WIDTH / 8 字节) 写入 out
+// frame 为整帧显存 (只读，可读取任意行)，显存本身不被修改
+typedef void (*MLCD_RowFilter_t)(int y, const uint8_t *frame, uint8_t *out);
+// 设置行合成回调，仅对下一次 MLCD_Refresh 生效 (页面过渡等需要每帧重新设置)
+void MLCD_SetRowFilter(MLCD_RowFilter_t filter);
+// 流式显示整屏图片：逐行解码后直接发送到屏幕，不经过显存 (用于启动画面)
+// 图片外区域填充背景色 (!color)；显存不变，下一次 MLCD_Refresh 会覆盖
+void MLCD_StreamImage(int x, int y, const MLCD_Bitmap_t *bmp, uint8_t color);
+
 void MLCD_CopyBuffer(uint8_t *dest);
 void MLCD_SetBuffer(const uint8_t *src);
 uint8_t* MLCD_GetBufferPtr(void);
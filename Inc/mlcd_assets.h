@@ -0,0 +1,41 @@
+//
+// Generated by tools/assetgen.py - do not edit.
+// Source: assets/icons/
+// Images: assets/images/
+// Sprites: assets/sprites/
+//
+
+#ifndef MLCD_DRIVER_MLCD_ASSETS_H
+#define MLCD_DRIVER_MLCD_ASSETS_H
+
+#include "mlcd.h"
+
+#define ICON_DAMPING_W      32
+#define ICON_DAMPING_H      32
+#define ICON_DAMPING_STRIDE 4
+extern const MLCD_Asset_t icon_damping;
+
+#define ICON_DISPLAY_W      32
+#define ICON_DISPLAY_H      32
+#define ICON_DISPLAY_STRIDE 4
+extern const MLCD_Asset_t icon_display;
+
+#define ICON_THEME_W      32
+#define ICON_THEME_H      32
+#define ICON_THEME_STRIDE 4
+extern const MLCD_Asset_t icon_theme;
+
+#define IMAGE_SPLASH_W      128
+#define IMAGE_SPLASH_H      128
+#define IMAGE_SPLASH_STRIDE 16
+extern const MLCD_Bitmap_t image_splash;
+
+#define SPRITE_SPINNER_W      24
+#define SPRITE_SPINNER_H      24
+#define SPRITE_SPINNER_STRIDE 3
+#define SPRITE_SPINNER_FRAMES 12
+extern const MLCD_Sprite_t sprite_spinner;
+
+// Bitmap data: 4556 bytes (10091 uncompressed)
+
+#endif //MLCD_DRIVER_MLCD_ASSETS_H
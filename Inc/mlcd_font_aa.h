@@ -0,0 +1,14 @@
+//
+// Generated by tools/fontgen.py - do not edit.
+// Source: Lato-Regular.ttf, sizes: 12 16, 4x oversampled, 4-bit coverage.
+//
+
+#ifndef MLCD_DRIVER_MLCD_FONT_AA_H
+#define MLCD_DRIVER_MLCD_FONT_AA_H
+
+#include "mlcd.h"
+
+extern const MLCD_FontDesc_t mlcd_font_aa12; // line height 15 px
+extern const MLCD_FontDesc_t mlcd_font_aa16; // line height 20 px
+
+#endif //MLCD_DRIVER_MLCD_FONT_AA_H
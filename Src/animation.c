@@ -3,45 +3,61 @@
 //
 
 #include "animation.h"
+#include "mlcd_assets.h"
+#include "frame_clock.h"
+#include "fastmath.h"
+#include "mesh_assets.h"
 #include <stdlib.h> // for rand, abs
-#include <stdio.h> // for sprintf
+#include <string.h> // for memcpy
 #include <math.h>
 
-#define BOX_COUNT 5
+#define BOX_COUNT 5           // 默认方块数
+#define BOX_STEP_HZ 60.0f  // 方块物理步频
+#define BOX_MAX_STEPS 8     // 单帧最多补偿的步数
+#define BOX_FRAC_BITS 8     // 位置/速度的小数位 (Q8.8)
 
 typedef struct {
-    int x, y;       // 位置
-    int dx, dy;     // 速度
-    int size;       // 边长
+    int32_t x, y;   // 位置 (Q8.8 像素)
+    int32_t dx, dy; // 速度 (Q8.8 像素/步)
+    int size;       // 边长 (像素)
 } Box;
 
-static Box boxes[BOX_COUNT];
+static Box boxes[BOX_MAX];
+static int box_count = BOX_COUNT;
 
 /**
  * @brief 检测两个方块是否相交 (AABB 碰撞检测)
  */
 static int CheckCollision(Box *a, Box *b) {
-    return (a->x < b->x + b->size &&
-            a->x + a->size > b->x &&
-            a->y < b->y + b->size &&
-            a->y + a->size > b->y);
+    int32_t sa = a->size << BOX_FRAC_BITS, sb = b->size << BOX_FRAC_BITS;
+    return (a->x < b->x + sb &&
+            a->x + sa > b->x &&
+            a->y < b->y + sb &&
+            a->y + sa > b->y);
 }
 
 /**
  * @brief 初始化动画状态
+ * 方块边长按数量缩放 (5 个时为 10~29 像素)，使方块总面积约占屏幕的 1/3
  */
 void Animation_Init(void) {
     srand(1234); // 固定种子
 
-    for (int i = 0; i < BOX_COUNT; i++) {
+    int size_max = (int)FastMath_Sqrt((float)(MLCD_WIDTH * MLCD_HEIGHT * 7 / 20) / box_count);
+    if (size_max > 30) size_max = 30;
+    if (size_max < 3) size_max = 3;
+    int size_min = size_max / 3;
+    if (size_min < 2) size_min = 2;
+
+    for (int i = 0; i < box_count; i++) {
         // 尝试生成不重叠的方块
         int valid_pos = 0;
         int attempts = 0;
         
         while (!valid_pos && attempts < 100) {
-            boxes[i].size = 10 + (rand() % 20); // 大小 10-30 随机
-            boxes[i].x = rand() % (MLCD_WIDTH - boxes[i].size);
-            boxes[i].y = rand() % (MLCD_HEIGHT - boxes[i].size);
+            boxes[i].size = size_min + (rand() % (size_max - size_min));
+            boxes[i].x = (rand() % (MLCD_WIDTH - boxes[i].size)) << BOX_FRAC_BITS;
+            boxes[i].y = (rand() % (MLCD_HEIGHT - boxes[i].size)) << BOX_FRAC_BITS;
             
             valid_pos = 1;
             // 检查是否与已生成的方块重叠
@@ -54,12 +70,23 @@ void Animation_Init(void) {
             attempts++;
         }
 
-        // 速度 -1 到 1，排除 0 (减慢速度)
-        do { boxes[i].dx = (rand() % 3) - 1; } while(boxes[i].dx == 0);
-        do { boxes[i].dy = (rand() % 3) - 1; } while(boxes[i].dy == 0);
+        // 每轴速度 0.5~1.5 像素/步，方向随机
+        boxes[i].dx = (128 + rand() % 256) * ((rand() & 1) ? 1 : -1);
+        boxes[i].dy = (128 + rand() % 256) * ((rand() & 1) ? 1 : -1);
     }
 }
 
+void Animation_Boxes_SetCount(int count) {
+    if (count < 1) count = 1;
+    if (count > BOX_MAX) count = BOX_MAX;
+    box_count = count;
+    Animation_Init();
+}
+
+int Animation_Boxes_GetCount(void) {
+    return box_count;
+}
+
 #include <stdbool.h>
 
 // ... (existing code)
@@ -69,17 +96,37 @@ void Animation_Init(void) {
 // ----------------------------------------------------------------------------
 
 static uint8_t old_page_buffer[MLCD_HEIGHT][MLCD_WIDTH / 8];
-static uint8_t new_page_buffer[MLCD_HEIGHT][MLCD_WIDTH / 8];
 static float transition_progress = 0.0f;
 static float transition_duration = 0.5f; // Default 0.5s
 static bool is_transitioning = false;
-
-// Bayer Matrix 4x4 (0-15)
-static const uint8_t bayer_matrix[4][4] = {
-    { 0,  8,  2, 10},
-    {12,  4, 14,  6},
-    { 3, 11,  1,  9},
-    {15,  7, 13,  5}
+static TransitionType_t transition_type = TRANSITION_DISSOLVE;
+static TransitionDir_t transition_dir = TRANSITION_DIR_FORWARD;
+
+#define BLINDS_HEIGHT 16 // 百叶窗叶片高度 (px)
+
+static void Transition_ComposeRow(int y, const uint8_t *new_frame, uint8_t *out);
+
+// Bayer Matrix 4x4 (mlcd_bayer4x4，0-15)，像素在 threshold > bayer[y % 4][x % 4] 时切换为新页面
+// 由 mlcd_bayer4x4 预计算的切换掩码 [threshold 0-16][y % 4]：位为 1 表示该像素取新页面
+// 按显存位序 (bit0 = x%8 == 0) 展开，每 4 位重复一次
+static const uint8_t bayer_masks[17][4] = {
+    {0x00, 0x00, 0x00, 0x00}, // 0
+    {0x11, 0x00, 0x00, 0x00}, // 1
+    {0x11, 0x00, 0x44, 0x00}, // 2
+    {0x55, 0x00, 0x44, 0x00}, // 3
+    {0x55, 0x00, 0x55, 0x00}, // 4
+    {0x55, 0x22, 0x55, 0x00}, // 5
+    {0x55, 0x22, 0x55, 0x88}, // 6
+    {0x55, 0xAA, 0x55, 0x88}, // 7
+    {0x55, 0xAA, 0x55, 0xAA}, // 8
+    {0x77, 0xAA, 0x55, 0xAA}, // 9
+    {0x77, 0xAA, 0xDD, 0xAA}, // 10
+    {0xFF, 0xAA, 0xDD, 0xAA}, // 11
+    {0xFF, 0xAA, 0xFF, 0xAA}, // 12
+    {0xFF, 0xBB, 0xFF, 0xAA}, // 13
+    {0xFF, 0xBB, 0xFF, 0xEE}, // 14
+    {0xFF, 0xFF, 0xFF, 0xEE}, // 15
+    {0xFF, 0xFF, 0xFF, 0xFF}, // 16
 };
 
 void Animation_SetTransitionDuration(float duration) {
@@ -87,9 +134,36 @@ void Animation_SetTransitionDuration(float duration) {
     transition_duration = duration;
 }
 
+void Animation_SetTransitionType(TransitionType_t type) {
+    if (type >= TRANSITION_COUNT) type = TRANSITION_DISSOLVE;
+    transition_type = type;
+}
+
+TransitionType_t Animation_GetTransitionType(void) {
+    return transition_type;
+}
+
 void Animation_Transition_Start(void) {
-    MLCD_CopyBuffer((uint8_t*)old_page_buffer);
+    Animation_Transition_StartDir(TRANSITION_DIR_FORWARD);
+}
+
+void Animation_Transition_StartDir(TransitionDir_t dir) {
+    if (is_transitioning) {
+        // 过渡进行中：屏幕上是合成画面而不是显存，按当前进度把合成结果作为新的旧页面
+        // 推入效果会读取旧页面的其他行，按读取方向遍历，保证读到的行尚未被覆盖
+        const uint8_t *frame = MLCD_GetBufferPtr();
+        uint8_t row[MLCD_WIDTH / 8];
+        bool reverse = (transition_type == TRANSITION_PUSH && transition_dir == TRANSITION_DIR_BACKWARD);
+        for (int i = 0; i < MLCD_HEIGHT; i++) {
+            int y = reverse ? MLCD_HEIGHT - 1 - i : i;
+            Transition_ComposeRow(y, frame, row);
+            memcpy(old_page_buffer[y], row, MLCD_WIDTH / 8);
+        }
+    } else {
+        MLCD_CopyBuffer((uint8_t*)old_page_buffer);
+    }
     transition_progress = 0.0f;
+    transition_dir = dir;
     is_transitioning = true;
 }
 
@@ -111,78 +185,125 @@ bool Animation_IsTransitioning(void) {
     return is_transitioning;
 }
 
-void Animation_Transition_Apply(void) {
-    if (!is_transitioning) return;
-    
-    // 1. 捕获当前应用绘制的新页面
-    MLCD_CopyBuffer((uint8_t*)new_page_buffer);
-    
-    uint8_t *dest = MLCD_GetBufferPtr();
-    int threshold = (int)(transition_progress * 17); // 0-16 (覆盖 0-15)
-    
-    // 获取当前深色模式设置 (需从 menu.c 引用或通过参数传递，这里假设可以访问全局)
-    // 暂时用 extern 声明，或者通过参数
-    extern bool setting_dark_mode;
-    
-    // 2. 混合 (Dither Dissolve)
-    for (int y = 0; y < MLCD_HEIGHT; y++) {
-        for (int col = 0; col < MLCD_WIDTH / 8; col++) {
-            uint8_t old_byte = old_page_buffer[y][col];
-            uint8_t new_byte = new_page_buffer[y][col];
-            uint8_t res_byte = 0;
-            
-            for (int bit = 0; bit < 8; bit++) {
-                int x = col * 8 + bit;
-                uint8_t bayer_val = bayer_matrix[y % 4][x % 4];
-                
-                // 提取旧像素和新像素的值 (0 or 1)
-                uint8_t old_pixel = (old_byte >> bit) & 0x01;
-                uint8_t new_pixel = (new_byte >> bit) & 0x01;
-                uint8_t out_pixel = 0;
-                
-                // 确定是否应用过渡效果
-                // 规则：只有当像素在任意一帧中是“内容色”时才应用抖动
-                // Normal Mode (White BG=1, Black FG=0): 内容是 0
-                // Dark Mode (Black BG=0, White FG=1): 内容是 1
-                
-                bool apply_dither = false;
-                
-                if (setting_dark_mode) {
-                    // Dark Mode: 背景是 0，内容是 1
-                    // 如果任意一个是 1 (内容)，则应用抖动
-                    if (old_pixel == 1 || new_pixel == 1) {
-                        apply_dither = true;
-                    }
-                } else {
-                    // Normal Mode: 背景是 1，内容是 0
-                    // 如果任意一个是 0 (内容)，则应用抖动
-                    if (old_pixel == 0 || new_pixel == 0) {
-                        apply_dither = true;
-                    }
-                }
-                
-                if (apply_dither) {
-                    // 应用 Bayer 阈值切换
-                    if (threshold > bayer_val) {
-                        out_pixel = new_pixel;
-                    } else {
-                        out_pixel = old_pixel;
-                    }
-                } else {
-                    // 纯背景区域，直接显示新页面 (或者旧页面，反正是一样的)
-                    out_pixel = new_pixel; 
-                }
-                
-                // 写入结果
-                if (out_pixel) {
-                    res_byte |= (1 << bit);
-                }
+/**
+ * @brief 行内平移：dst[x] = src[x + shift]，越界像素为 0 (显存位序)
+ */
+static void Row_Shift(uint8_t *dst, const uint8_t *src, int shift) {
+    int idx = shift >> 3; // 算术右移，负数向下取整
+    int sh = shift & 7;
+    for (int b = 0; b < MLCD_WIDTH / 8; b++, idx++) {
+        uint16_t lo = (idx >= 0 && idx < MLCD_WIDTH / 8) ? src[idx] : 0;
+        uint16_t hi = (idx + 1 >= 0 && idx + 1 < MLCD_WIDTH / 8) ? src[idx + 1] : 0;
+        dst[b] = (uint8_t)(((hi << 8) | lo) >> sh);
+    }
+}
+
+/**
+ * @brief 生成 [x0, x1) 范围为 1 的行掩码
+ */
+static void Row_SpanMask(uint8_t *mask, int x0, int x1) {
+    if (x0 < 0) x0 = 0;
+    if (x1 > MLCD_WIDTH) x1 = MLCD_WIDTH;
+    for (int b = 0; b < MLCD_WIDTH / 8; b++) {
+        int lo = x0 - b * 8, hi = x1 - b * 8;
+        if (lo < 0) lo = 0;
+        if (hi > 8) hi = 8;
+        mask[b] = (hi > lo) ? (uint8_t)(((1u << hi) - 1) & ~((1u << lo) - 1)) : 0;
+    }
+}
+
+/**
+ * @brief 按掩码选择：out = new & mask | old & ~mask (32 位字)
+ */
+static void Row_Select(uint8_t *out, const uint8_t *new_row, const uint8_t *old_row, const uint8_t *mask) {
+    for (int i = 0; i < MLCD_WIDTH / 8; i += 4) {
+        uint32_t nw, ow, mw;
+        memcpy(&nw, new_row + i, 4);
+        memcpy(&ow, old_row + i, 4);
+        memcpy(&mw, mask + i, 4);
+        nw = (nw & mw) | (ow & ~mw);
+        memcpy(out + i, &nw, 4);
+    }
+}
+
+/**
+ * @brief 合成过渡画面的第 y 行 (MLCD_RowFilter_t，在 MLCD_Refresh 组包时调用)
+ * @param new_frame 新页面 (整帧显存，只读)
+ * @param out 输出行 (16 字节)，不能与 new_frame 或 old_page_buffer 重叠
+ */
+static void Transition_ComposeRow(int y, const uint8_t *new_frame, uint8_t *out) {
+    const int stride = MLCD_WIDTH / 8;
+    const uint8_t *new_row = new_frame + y * stride;
+    const uint8_t *old_row = old_page_buffer[y];
+    bool fwd = (transition_dir == TRANSITION_DIR_FORWARD);
+    float p = transition_progress;
+    uint8_t tmp[MLCD_WIDTH / 8];
+    uint8_t mask[MLCD_WIDTH / 8];
+
+    switch (transition_type) {
+        case TRANSITION_SLIDE: {
+            // 旧页面整体移出，新页面紧随其后 (与 BLIT 一样按字节移位拼接)
+            int s = (Animation_Ease(EASE_OUT_CUBIC, (int32_t)(p * 65536)) * MLCD_WIDTH) >> 16;
+            if (fwd) {
+                Row_Shift(tmp, new_row, s - MLCD_WIDTH);
+                Row_Shift(out, old_row, s);
+            } else {
+                Row_Shift(tmp, new_row, MLCD_WIDTH - s);
+                Row_Shift(out, old_row, -s);
+            }
+            for (int b = 0; b < stride; b++) out[b] |= tmp[b];
+            break;
+        }
+        case TRANSITION_PUSH: {
+            // 整行重映射：行号落在旧页面范围内取旧行，否则取新页面对应行
+            int s = (Animation_Ease(EASE_OUT_CUBIC, (int32_t)(p * 65536)) * MLCD_HEIGHT) >> 16;
+            int src = fwd ? y + s : y - s;
+            if (src >= 0 && src < MLCD_HEIGHT) {
+                memcpy(out, old_page_buffer[src], stride);
+            } else {
+                src += fwd ? -MLCD_HEIGHT : MLCD_HEIGHT;
+                memcpy(out, new_frame + src * stride, stride);
             }
-            dest[y * (MLCD_WIDTH / 8) + col] = res_byte;
+            break;
+        }
+        case TRANSITION_IRIS: {
+            // 圆内显示新页面，半径从 0 增长到覆盖屏幕四角
+            const float r_max = 90.6f; // sqrt(64^2 + 64^2)
+            float r = p * r_max;
+            float dy = (y + 0.5f) - MLCD_HEIGHT / 2;
+            float w2 = r * r - dy * dy;
+            int half = (int)(FastMath_Sqrt(w2) + 0.5f);
+            Row_SpanMask(mask, MLCD_WIDTH / 2 - half, MLCD_WIDTH / 2 + half);
+            Row_Select(out, new_row, old_row, mask);
+            break;
+        }
+        case TRANSITION_BLINDS: {
+            // 每个叶片内按行依次翻转为新页面
+            int shown = (int)(p * (BLINDS_HEIGHT + 1));
+            memcpy(out, ((y % BLINDS_HEIGHT) < shown) ? new_row : old_row, stride);
+            break;
+        }
+        case TRANSITION_DISSOLVE:
+        default: {
+            // 混合 (Dither Dissolve)：out = (new & mask) | (old & ~mask)，按 32 位字整行处理
+            // 原规则只对“内容色”像素做抖动，背景像素直接取新页面；但两帧都是背景时新旧像素本就相同，
+            // 因此深色/浅色模式都退化为同一个按位选择，结果逐位一致，无需区分 setting_dark_mode
+            int threshold = (int)(p * 17); // 0-16 (覆盖 0-15)
+            if (threshold > 16) threshold = 16;
+            memset(mask, bayer_masks[threshold][y & 3], stride);
+            Row_Select(out, new_row, old_row, mask);
+            break;
         }
     }
 }
 
+void Animation_Transition_Apply(void) {
+    if (!is_transitioning) return;
+
+    // 不修改显存：由 MLCD_Refresh 在组装每行 SPI 数据包时合成旧页面与新页面
+    MLCD_SetRowFilter(Transition_ComposeRow);
+}
+
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -194,96 +315,350 @@ void Animation_Transition_Apply(void) {
 // 3D Cube Animation Implementation
 // ----------------------------------------------------------------------------
 
-typedef struct {
-    float x, y, z;
-} Point3D;
+// 网格数据由 tools/meshgen.py 从 assets/meshes/*.obj 编译为 Flash 常量 (mesh_assets.c)，
+// 格式见 mesh.h；投影缓冲按 MESH_MAX_VERTICES / MESH_MAX_FACES (最大的网格) 静态分配
 
 typedef struct {
     int x, y;
 } Point2D;
 
-// 正方体顶点 (中心在原点, 边长为 2)
-static Point3D cube_vertices[8] = {
-    {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
-    {-1, -1, 1},  {1, -1, 1},  {1, 1, 1},  {-1, 1, 1}
-};
-
-// 正方体边 (连接顶点的索引)
-static int cube_edges[12][2] = {
-    {0,1}, {1,2}, {2,3}, {3,0}, // Back face
-    {4,5}, {5,6}, {6,7}, {7,4}, // Front face
-    {0,4}, {1,5}, {2,6}, {3,7}  // Connecting edges
-};
+typedef struct {
+    float m[3][3];
+} Matrix3D;
 
 static float angle_x = 0;
 static float angle_y = 0;
 static float angle_z = 0;
 
+// 深度提示：按边的平均深度在 [zmin, zmax] 中的位置 t 决定密度，
+// t < DEPTH_CUE_SOLID 为实线，之后线性降到 DEPTH_CUE_MIN_DENSITY/16
+#define DEPTH_CUE_SOLID       0.5f
+#define DEPTH_CUE_MIN_DENSITY 4
+
+static float camera_distance = ANIMATION3D_CAMERA_DISTANCE;
+static bool depth_cue = true;
+static bool hidden_line_removal = true;
+static bool line_aa = false;
+static Render3DMode_t render_mode = RENDER3D_WIREFRAME;
+
+// 填充渲染的平行光方向 (视图空间，指向光源：左上方、朝向相机)，单位向量
+#define LIGHT_X (-0.36f)
+#define LIGHT_Y (-0.48f)
+#define LIGHT_Z (-0.80f)
+// 填充面的 Bayer 亮度范围 (白像素数 / 16)：最亮的面也保留少量黑点，避免与白色背景融为一体
+#define SHADE_MIN_DENSITY 1
+#define SHADE_MAX_DENSITY 13
+
+void Animation3D_SetCamera(float distance) {
+    camera_distance = distance;
+}
+
+void Animation3D_SetDepthCue(bool enable) {
+    depth_cue = enable;
+}
+
+void Animation3D_SetHiddenLineRemoval(bool enable) {
+    hidden_line_removal = enable;
+}
+
+void Animation3D_SetAntiAlias(bool enable) {
+    line_aa = enable;
+}
+
+void Animation3D_SetRenderMode(Render3DMode_t mode) {
+    render_mode = mode;
+}
+
+/**
+ * @brief 扫描线填充凸多边形 (三角形/四边形)
+ * 逐条边求每行交点 x = a.x + dx * t / dy (四舍五入，0.5 取 +x)，记录每行的左右端点，再按行输出水平跨度。
+ * 交点用商 + 余数逐行累加 (Bresenham 式误差项)，结果与逐行精确除法完全一致，每行只有加法和一次比较
+ * @param density Bayer 亮度级别 0~16 (白像素数 / 16)
+ */
+static void Raster_FillConvex(const Point2D *pts, int n, uint8_t density) {
+    static int16_t span_l[MLCD_HEIGHT], span_r[MLCD_HEIGHT];
+
+    int ymin = pts[0].y, ymax = pts[0].y;
+    for (int k = 1; k < n; k++) {
+        if (pts[k].y < ymin) ymin = pts[k].y;
+        if (pts[k].y > ymax) ymax = pts[k].y;
+    }
+    if (ymax < 0 || ymin >= MLCD_HEIGHT) return;
+    if (ymin < 0) ymin = 0;
+    if (ymax > MLCD_HEIGHT - 1) ymax = MLCD_HEIGHT - 1;
+
+    for (int y = ymin; y <= ymax; y++) {
+        span_l[y] = INT16_MAX;
+        span_r[y] = INT16_MIN;
+    }
+
+    for (int k = 0; k < n; k++) {
+        const Point2D *a = &pts[k];
+        const Point2D *b = &pts[(k + 1) % n];
+        if (a->y > b->y) { const Point2D *t = a; a = b; b = t; }
+        if (b->y < ymin || a->y > ymax) continue;
+
+        if (a->y == b->y) {
+            // 水平边：两个端点都在该行
+            int y = a->y;
+            int l = (a->x < b->x) ? a->x : b->x, r = (a->x < b->x) ? b->x : a->x;
+            if (l < span_l[y]) span_l[y] = (int16_t)l;
+            if (r > span_r[y]) span_r[y] = (int16_t)r;
+            continue;
+        }
+
+        // x - a.x = floor((2 dx t + dy) / (2 dy))：t = 0 时商为 0、余数为 dy，之后每行加上固定的商/余数步进
+        int32_t dx = b->x - a->x, den = 2 * (b->y - a->y);
+        int32_t step_q = (2 * dx) / den, step_r = (2 * dx) % den;
+        if (step_r < 0) { step_q--; step_r += den; }
+        int32_t q = 0, r = den >> 1;
+        int y0 = a->y, y1 = (b->y > ymax) ? ymax : b->y;
+        if (y0 < ymin) {
+            // 起点在屏幕上方：一次跳过被裁掉的行
+            int32_t skip = ymin - y0;
+            q = step_q * skip;
+            r += step_r * skip;
+            q += r / den;
+            r %= den;
+            y0 = ymin;
+        }
+
+        for (int y = y0; y <= y1; y++) {
+            int xi = a->x + q;
+            if (xi < span_l[y]) span_l[y] = (int16_t)xi;
+            if (xi > span_r[y]) span_r[y] = (int16_t)xi;
+            r += step_r;
+            int32_t carry = (r >= den); // 无分支进位，避免数据相关的分支预测失败
+            q += step_q + carry;
+            r -= den & -carry;
+        }
+    }
+
+    for (int y = ymin; y <= ymax; y++) {
+        if (span_l[y] <= span_r[y]) {
+            MLCD_FillSpan(y, span_l[y], span_r[y], bayer_masks[density][y & 3]);
+        }
+    }
+}
+
+// 读取第 f 个面的顶点索引，返回顶点数 (3 或 4)
+static inline int Mesh3D_Face(const Mesh_t *mesh, int f, int face[4]) {
+    for (int k = 0; k < 4; k++) face[k] = Mesh_Index(mesh, mesh->faces, f * 4 + k);
+    return (face[3] < 0) ? 3 : 4;
+}
+
+/**
+ * @brief 由欧拉角构造组合旋转矩阵 R = Rz * Ry * Rx (先绕 X，再绕 Y，最后绕 Z)
+ * 每帧只查一次三角函数表，之后每个顶点只需 9 次乘加
+ */
+static void Matrix3D_Rotation(Matrix3D *r, float ax, float ay, float az) {
+    float cx, sx, cy, sy, cz, sz;
+    FastMath_SinCos(ax, &sx, &cx);
+    FastMath_SinCos(ay, &sy, &cy);
+    FastMath_SinCos(az, &sz, &cz);
+
+    r->m[0][0] = cy * cz;
+    r->m[0][1] = sx * sy * cz - cx * sz;
+    r->m[0][2] = cx * sy * cz + sx * sz;
+
+    r->m[1][0] = cy * sz;
+    r->m[1][1] = sx * sy * sz + cx * cz;
+    r->m[1][2] = cx * sy * sz - sx * cz;
+
+    r->m[2][0] = -sy;
+    r->m[2][1] = sx * cy;
+    r->m[2][2] = cx * cy;
+}
+
 /**
  * @brief 3D 投影和旋转通用辅助函数
+ * 按当前 angle_x/y/z 构造一次旋转矩阵，变换所有顶点后做透视投影并绘制所有边
+ * 相机位于 -z 方向 camera_distance 处，z = 0 平面上的缩放为 scale
+ * 开启消隐时，只绘制至少有一个相邻面朝向相机的边 (正面边与轮廓边)；
+ * 填充模式下按画家算法绘制 Lambert 着色的正面，不绘制边；
+ * 开启抗锯齿时，边以亚像素端点按 MLCD_DrawLineAA 绘制
  */
-static void ProjectAndDraw(Point3D *vertices, int v_count, int (*edges)[2], int e_count, float scale) {
-    Point2D projected_points[32]; // 假设最大顶点数不超过 32
-    if (v_count > 32) v_count = 32;
+static void ProjectAndDraw(const Mesh_t *mesh, float scale) {
+    // 静态缓冲 (按最大的网格分配)，避免占用任务栈
+    static Point2D projected_points[MESH_MAX_VERTICES];
+    static Point2D projected_sub[MESH_MAX_VERTICES]; // 抗锯齿线用的亚像素坐标 (1/MLCD_SUBPIXEL 像素)
+    static float depth[MESH_MAX_VERTICES];
+    static bool face_front[MESH_MAX_FACES];
+    static float face_depth[MESH_MAX_FACES];
+    static uint16_t face_order[MESH_MAX_FACES]; // 画家算法排序结果，跨帧保留 (帧间顺序变化小，插入排序接近线性)
+    static const Mesh_t *order_mesh = NULL;
+
+    int v_count = mesh->vertex_count;
+    int e_count = mesh->edge_count;
+    int f_count = mesh->faces ? mesh->face_count : 0;
+
+    // 缓冲只够同一次 meshgen 生成的最大网格，其他来源的更大网格不绘制 (避免越界写)
+    if (v_count > MESH_MAX_VERTICES || f_count > MESH_MAX_FACES) return;
 
     int offset_x = MLCD_WIDTH / 2;
     int offset_y = MLCD_HEIGHT / 2;
+    float dist = camera_distance;
+    float zmin = 1e30f, zmax = -1e30f;
+
+    Matrix3D rot;
+    Matrix3D_Rotation(&rot, angle_x, angle_y, angle_z);
+
+    // 反量化并入矩阵：顶点直接以整数参与运算
+    float unit = 1.0f / Mesh_Unit(mesh);
+    float m00 = rot.m[0][0] * scale * unit, m01 = rot.m[0][1] * scale * unit, m02 = rot.m[0][2] * scale * unit;
+    float m10 = rot.m[1][0] * scale * unit, m11 = rot.m[1][1] * scale * unit, m12 = rot.m[1][2] * scale * unit;
+    float m20 = rot.m[2][0] * unit, m21 = rot.m[2][1] * unit, m22 = rot.m[2][2] * unit;
 
-    // 旋转并投影所有顶点
     for (int i = 0; i < v_count; i++) {
-        float x = vertices[i].x;
-        float y = vertices[i].y;
-        float z = vertices[i].z;
+        int32_t qx, qy, qz;
+        Mesh_Vertex(mesh, i, &qx, &qy, &qz);
+        float x = (float)qx;
+        float y = (float)qy;
+        float z = (float)qz;
+
+        float px = m00 * x + m01 * y + m02 * z;
+        float py = m10 * x + m11 * y + m12 * z;
+        float pz = m20 * x + m21 * y + m22 * z; // 越大越远
+
+        // 透视除法：k = d / (d + z)，越近越大 (正交投影时 k = 1)
+        if (dist > 0.0f) {
+            float den = dist + pz;
+            if (den < 0.1f) den = 0.1f; // 顶点到达相机平面时避免除零/翻转
+            float k = dist * FastMath_Recip(den);
+            px *= k;
+            py *= k;
+        }
+
+        projected_points[i].x = (int)px + offset_x;
+        projected_points[i].y = (int)py + offset_y;
+        if (line_aa) {
+            projected_sub[i].x = (int)((px + offset_x) * MLCD_SUBPIXEL);
+            projected_sub[i].y = (int)((py + offset_y) * MLCD_SUBPIXEL);
+        }
+        depth[i] = pz;
+        if (pz < zmin) zmin = pz;
+        if (pz > zmax) zmax = pz;
+    }
 
-        // 绕 X 轴旋转
-        float temp_y = y * cosf(angle_x) - z * sinf(angle_x);
-        float temp_z = y * sinf(angle_x) + z * cosf(angle_x);
-        y = temp_y;
-        z = temp_z;
+    // 背面剔除：按投影后多边形的有向面积判断朝向 (屏幕 y 轴向下，朝向相机的面为负)
+    // 在屏幕空间计算，透视投影下同样正确
+    bool filled = (render_mode == RENDER3D_FILLED) && f_count > 0;
+    bool cull = (hidden_line_removal || filled) && f_count > 0;
+    if (cull) {
+        for (int f = 0; f < f_count; f++) {
+            int face[4];
+            int n = Mesh3D_Face(mesh, f, face);
+            int area2 = 0;
+            for (int k = 0; k < n; k++) {
+                const Point2D *p = &projected_points[face[k]];
+                const Point2D *q = &projected_points[face[(k + 1) % n]];
+                area2 += p->x * q->y - q->x * p->y;
+            }
+            face_front[f] = (area2 < 0);
+        }
+    }
 
-        // 绕 Y 轴旋转
-        float temp_x = x * cosf(angle_y) + z * sinf(angle_y);
-        temp_z = -x * sinf(angle_y) + z * cosf(angle_y);
-        x = temp_x;
-        z = temp_z;
+    if (filled) {
+        // 画家算法：按面的平均深度从远到近排序后依次填充 (凸网格只有正面可见，非凸网格也能正确遮挡)
+        if (order_mesh != mesh) {
+            for (int f = 0; f < f_count; f++) face_order[f] = (uint16_t)f;
+            order_mesh = mesh;
+        }
+        for (int f = 0; f < f_count; f++) {
+            int face[4];
+            int n = Mesh3D_Face(mesh, f, face);
+            float z = 0.0f;
+            for (int k = 0; k < n; k++) z += depth[face[k]];
+            face_depth[f] = z / n;
+        }
+        for (int i = 1; i < f_count; i++) {
+            uint16_t f = face_order[i];
+            int j = i - 1;
+            while (j >= 0 && face_depth[face_order[j]] < face_depth[f]) {
+                face_order[j + 1] = face_order[j];
+                j--;
+            }
+            face_order[j + 1] = f;
+        }
 
-        // 绕 Z 轴旋转
-        temp_x = x * cosf(angle_z) - y * sinf(angle_z);
-        temp_y = x * sinf(angle_z) + y * cosf(angle_z);
-        x = temp_x;
-        y = temp_y;
+        // Lambert 光照：面法线只需旋转 (不受透视影响)，亮度映射到 Bayer 级别
+        // 光照向量先旋转到模型空间 (L' = R^T L)，每个面只需与量化法线做一次点积
+        const float nu = 1.0f / MESH_NORMAL_UNIT;
+        float lx = (rot.m[0][0] * LIGHT_X + rot.m[1][0] * LIGHT_Y + rot.m[2][0] * LIGHT_Z) * nu;
+        float ly = (rot.m[0][1] * LIGHT_X + rot.m[1][1] * LIGHT_Y + rot.m[2][1] * LIGHT_Z) * nu;
+        float lz = (rot.m[0][2] * LIGHT_X + rot.m[1][2] * LIGHT_Y + rot.m[2][2] * LIGHT_Z) * nu;
+        extern bool setting_dark_mode;
+
+        for (int i = 0; i < f_count; i++) {
+            int f = face_order[i];
+            if (!face_front[f]) continue;
+
+            const int8_t *nrm = &mesh->normals[f * 3];
+            float lambert = nrm[0] * lx + nrm[1] * ly + nrm[2] * lz;
+            if (lambert < 0.0f) lambert = 0.0f;
+            int density = SHADE_MIN_DENSITY + (int)(lambert * (SHADE_MAX_DENSITY - SHADE_MIN_DENSITY) + 0.5f);
+            // 深色模式在整帧绘制后反色：白像素数取补，反色后亮面仍然最亮
+            if (setting_dark_mode) density = 16 - density;
+
+            int face[4];
+            int n = Mesh3D_Face(mesh, f, face);
+            Point2D pts[4];
+            for (int k = 0; k < n; k++) pts[k] = projected_points[face[k]];
+            Raster_FillConvex(pts, n, (uint8_t)density);
+        }
+        return;
+    }
 
-        // 简单的正交投影
-        projected_points[i].x = (int)(x * scale) + offset_x;
-        projected_points[i].y = (int)(y * scale) + offset_y;
+    // 深度提示：每条边只取两端点的平均深度，无需 Z 缓冲
+    float cue_scale = 0.0f;
+    if (depth_cue && zmax - zmin > 1e-6f) {
+        // 将 t ∈ [DEPTH_CUE_SOLID, 1] 映射为密度 16 -> DEPTH_CUE_MIN_DENSITY
+        cue_scale = (16 - DEPTH_CUE_MIN_DENSITY) / ((1.0f - DEPTH_CUE_SOLID) * (zmax - zmin));
     }
+    float cue_start = zmin + DEPTH_CUE_SOLID * (zmax - zmin);
 
     // 绘制所有边
     for (int i = 0; i < e_count; i++) {
-        int p1_idx = edges[i][0];
-        int p2_idx = edges[i][1];
-        
-        MLCD_DrawLine(projected_points[p1_idx].x, projected_points[p1_idx].y,
-                      projected_points[p2_idx].x, projected_points[p2_idx].y,
-                      MLCD_COLOR_BLACK);
+        int p1_idx = Mesh_Index(mesh, mesh->edges, i * 4);
+        int p2_idx = Mesh_Index(mesh, mesh->edges, i * 4 + 1);
+
+        if (cull) {
+            // 两个相邻面都背向相机的边被遮挡 (没有相邻面的边总是绘制)
+            int fa = Mesh_Index(mesh, mesh->edges, i * 4 + 2);
+            int fb = Mesh_Index(mesh, mesh->edges, i * 4 + 3);
+            if (fa >= 0 && !face_front[fa] && (fb < 0 || !face_front[fb])) continue;
+        }
+
+        int density = 16;
+        if (cue_scale > 0.0f) {
+            float z = 0.5f * (depth[p1_idx] + depth[p2_idx]);
+            if (z > cue_start) density = 16 - (int)((z - cue_start) * cue_scale + 0.5f);
+        }
+
+        if (line_aa) {
+            MLCD_DrawLineAA(projected_sub[p1_idx].x, projected_sub[p1_idx].y,
+                            projected_sub[p2_idx].x, projected_sub[p2_idx].y,
+                            MLCD_COLOR_BLACK, (uint8_t)density);
+        } else {
+            MLCD_DrawLineDither(projected_points[p1_idx].x, projected_points[p1_idx].y,
+                                projected_points[p2_idx].x, projected_points[p2_idx].y,
+                                MLCD_COLOR_BLACK, (uint8_t)density);
+        }
     }
 }
 
+// 按角速度 (rad/s) 推进旋转角；每帧回绕到 [-π, π)，长时间运行也保持在 FastMath_SinCos 的精度范围内
+static void Demo3D_Rotate(float wx, float wy, float wz) {
+    float dt = FrameClock_GetDt();
+    angle_x = FastMath_WrapAngle(angle_x + wx * dt);
+    angle_y = FastMath_WrapAngle(angle_y + wy * dt);
+    angle_z = FastMath_WrapAngle(angle_z + wz * dt);
+}
+
 static void ShowFPS(void) {
-    static uint32_t last_tick = 0;
-    static int frame_count = 0;
-    static int fps = 0;
-    
-    frame_count++;
-    uint32_t current_tick = HAL_GetTick();
-    if (current_tick - last_tick >= 1000) {
-        fps = frame_count;
-        frame_count = 0;
-        last_tick = current_tick;
-    }
-    
     char fps_str[16];
-    sprintf(fps_str, "FPS: %d", fps);
+    memcpy(fps_str, "FPS: ", 5);
+    MLCD_FormatInt(fps_str + 5, sizeof(fps_str) - 5, FrameClock_GetFPS());
     MLCD_DrawString(2, 2, fps_str, MLCD_COLOR_BLACK);
 }
 
@@ -299,8 +674,9 @@ void Animation3D_Cube_Run(void) {
     // 1. 始终清除为白底 (便于后续绘制黑线)
     MLCD_ClearBuffer();
 
-    angle_x += 0.03f; angle_y += 0.05f; angle_z += 0.02f;
-    ProjectAndDraw(cube_vertices, 8, cube_edges, 12, 30.0f);
+    // 旋转速度 (rad/s)，按帧时钟推进
+    Demo3D_Rotate(1.875f, 3.125f, 1.25f);
+    ProjectAndDraw(&mesh_cube, 30.0f);
     ShowFPS();
     
     // 如果是深色模式，对整个画面取反 (白底黑线 -> 黑底白线)
@@ -316,34 +692,16 @@ void Animation3D_Cube_Run(void) {
 // 2. Pyramid (Tetrahedron) Animation
 // ----------------------------------------------------------------------------
 
-static Point3D pyramid_vertices[4] = {
-    {0, -1, 0},      // Top point
-    {-1, 1, -1},     // Base 1
-    {1, 1, -1},      // Base 2
-    {0, 1, 1}        // Base 3 (approx triangle base)
-};
-
-static int pyramid_edges[6][2] = {
-    {0,1}, {0,2}, {0,3}, // Sides
-    {1,2}, {2,3}, {3,1}  // Base
-};
-
 void Animation3D_Pyramid_Init(void) {
     angle_x = 0; angle_y = 0; angle_z = 0;
-    // 调整一下顶点使其更像正四面体
-    float h = 1.0f / sqrtf(2.0f);
-    pyramid_vertices[0] = (Point3D){0, -1, 0};
-    pyramid_vertices[1] = (Point3D){-1, 1, -h};
-    pyramid_vertices[2] = (Point3D){1, 1, -h};
-    pyramid_vertices[3] = (Point3D){0, 1, h};
 }
 
 void Animation3D_Pyramid_Run(void) {
     // 1. 始终清除为白底
     MLCD_ClearBuffer();
 
-    angle_x += 0.04f; angle_y -= 0.03f;
-    ProjectAndDraw(pyramid_vertices, 4, pyramid_edges, 6, 40.0f);
+    Demo3D_Rotate(2.5f, -1.875f, 0.0f);
+    ProjectAndDraw(&mesh_pyramid, 40.0f);
     ShowFPS();
     
     // 如果是深色模式，对整个画面取反
@@ -359,131 +717,16 @@ void Animation3D_Pyramid_Run(void) {
 // 3. Sphere (Wireframe) Animation
 // ----------------------------------------------------------------------------
 
-#define SPHERE_RINGS 8
-#define SPHERE_SEGS 12
-#define SPHERE_V_COUNT (SPHERE_RINGS * SPHERE_SEGS + 2) // +2 for poles
-#define SPHERE_E_COUNT (SPHERE_RINGS * SPHERE_SEGS * 2 + SPHERE_SEGS * 2)
-
-static Point3D sphere_vertices[SPHERE_V_COUNT];
-static int sphere_edges[SPHERE_E_COUNT][2];
-static int sphere_initialized = 0;
-
 void Animation3D_Sphere_Init(void) {
     angle_x = 0; angle_y = 0; angle_z = 0;
-    
-    if (sphere_initialized) return;
-    
-    int v_idx = 0;
-    
-    // Generate vertices
-    // Top pole
-    sphere_vertices[v_idx++] = (Point3D){0, -1, 0};
-    
-    for (int r = 0; r < SPHERE_RINGS; r++) {
-        float phi = M_PI * (r + 1) / (SPHERE_RINGS + 1);
-        for (int s = 0; s < SPHERE_SEGS; s++) {
-            float theta = 2.0f * M_PI * s / SPHERE_SEGS;
-            float x = sinf(phi) * cosf(theta);
-            float y = -cosf(phi); // Y up/down
-            float z = sinf(phi) * sinf(theta);
-            sphere_vertices[v_idx++] = (Point3D){x, y, z};
-        }
-    }
-    
-    // Bottom pole
-    sphere_vertices[v_idx++] = (Point3D){0, 1, 0};
-    
-    // Generate edges
-    int e_idx = 0;
-    
-    // Top cap
-    for (int s = 0; s < SPHERE_SEGS; s++) {
-        sphere_edges[e_idx][0] = 0;
-        sphere_edges[e_idx][1] = 1 + s;
-        e_idx++;
-    }
-    
-    // Body
-    for (int r = 0; r < SPHERE_RINGS - 1; r++) {
-        for (int s = 0; s < SPHERE_SEGS; s++) {
-            int cur = 1 + r * SPHERE_SEGS + s;
-            int next = 1 + r * SPHERE_SEGS + (s + 1) % SPHERE_SEGS;
-            int below = 1 + (r + 1) * SPHERE_SEGS + s;
-            
-            sphere_edges[e_idx][0] = cur;
-            sphere_edges[e_idx][1] = next; // Horizontal
-            e_idx++;
-            
-            sphere_edges[e_idx][0] = cur;
-            sphere_edges[e_idx][1] = below; // Vertical
-            e_idx++;
-        }
-    }
-    
-    // Bottom ring horizontal
-    for (int s = 0; s < SPHERE_SEGS; s++) {
-        int cur = 1 + (SPHERE_RINGS - 1) * SPHERE_SEGS + s;
-        int next = 1 + (SPHERE_RINGS - 1) * SPHERE_SEGS + (s + 1) % SPHERE_SEGS;
-        sphere_edges[e_idx][0] = cur;
-        sphere_edges[e_idx][1] = next;
-        e_idx++;
-    }
-
-    // Bottom cap
-    int bottom_pole_idx = v_idx - 1;
-    for (int s = 0; s < SPHERE_SEGS; s++) {
-        int cur = 1 + (SPHERE_RINGS - 1) * SPHERE_SEGS + s;
-        sphere_edges[e_idx][0] = cur;
-        sphere_edges[e_idx][1] = bottom_pole_idx;
-        e_idx++;
-    }
-    
-    sphere_initialized = 1;
 }
 
 void Animation3D_Sphere_Run(void) {
     // 1. 始终清除为白底
     MLCD_ClearBuffer();
     
-    angle_x += 0.02f; angle_y += 0.04f;
-    // Sphere has many vertices, use custom ProjectAndDraw to avoid stack overflow
-    // Re-implementing simplified version for Sphere due to array size limits in helper
-    
-    //Point2D projected_point;
-    int offset_x = MLCD_WIDTH / 2;
-    int offset_y = MLCD_HEIGHT / 2;
-    float scale = 45.0f;
-    
-    // We need to store projected points to draw edges
-    // Static buffer to avoid stack overflow
-    static Point2D sphere_proj[SPHERE_V_COUNT];
-
-    for (int i = 0; i < SPHERE_V_COUNT; i++) {
-        float x = sphere_vertices[i].x;
-        float y = sphere_vertices[i].y;
-        float z = sphere_vertices[i].z;
-
-        // Rotate
-        float temp_y = y * cosf(angle_x) - z * sinf(angle_x);
-        float temp_z = y * sinf(angle_x) + z * cosf(angle_x);
-        y = temp_y; z = temp_z;
-
-        float temp_x = x * cosf(angle_y) + z * sinf(angle_y);
-        temp_z = -x * sinf(angle_y) + z * cosf(angle_y);
-        x = temp_x; z = temp_z;
-
-        sphere_proj[i].x = (int)(x * scale) + offset_x;
-        sphere_proj[i].y = (int)(y * scale) + offset_y;
-    }
-
-    for (int i = 0; i < SPHERE_E_COUNT; i++) {
-        int p1 = sphere_edges[i][0];
-        int p2 = sphere_edges[i][1];
-        MLCD_DrawLine(sphere_proj[p1].x, sphere_proj[p1].y,
-                      sphere_proj[p2].x, sphere_proj[p2].y,
-                      MLCD_COLOR_BLACK);
-    }
-
+    Demo3D_Rotate(1.25f, 2.5f, 0.0f);
+    ProjectAndDraw(&mesh_sphere, 45.0f);
     ShowFPS();
     
     // 如果是深色模式，对整个画面取反
@@ -499,6 +742,58 @@ void Animation3D_Sphere_Run(void) {
 // Spring Damper Animation System Implementation
 // ----------------------------------------------------------------------------
 
+/**
+ * @brief 计算弹簧经过 dt 后的精确状态转移矩阵 (解析解，与步长无关)
+ * 方程 x'' + c x' + k x = 0 (m = 1，x 为相对目标的位移) 是线性的，
+ * 因此 [x; v](t + dt) = M * [x; v](t)，M = {m00, m01, m10, m11}
+ */
+static void Spring_Transition(float k, float c, float dt, float m[4]) {
+    if (k <= 0.0f) {
+        // 无刚度：仅阻尼减速
+        float e = expf(-c * dt);
+        m[0] = 1.0f;
+        m[1] = (c > 0.0f) ? (1.0f - e) / c : dt;
+        m[2] = 0.0f;
+        m[3] = e;
+        return;
+    }
+
+    float w0 = sqrtf(k);
+    float zeta = c / (2.0f * w0);
+
+    if (zeta < 0.999f) {
+        // 欠阻尼：衰减振荡
+        float a = zeta * w0;
+        float wd = w0 * sqrtf(1.0f - zeta * zeta);
+        float e = expf(-a * dt);
+        float cs = cosf(wd * dt);
+        float sn = sinf(wd * dt) / wd;
+        m[0] = e * (cs + a * sn);
+        m[1] = e * sn;
+        m[2] = -e * k * sn;
+        m[3] = e * (cs - a * sn);
+    } else if (zeta <= 1.001f) {
+        // 临界阻尼：最快无超调
+        float e = expf(-w0 * dt);
+        m[0] = e * (1.0f + w0 * dt);
+        m[1] = e * dt;
+        m[2] = -e * k * dt;
+        m[3] = e * (1.0f - w0 * dt);
+    } else {
+        // 过阻尼：两个实根的指数衰减之和
+        float d = w0 * sqrtf(zeta * zeta - 1.0f);
+        float r1 = -zeta * w0 + d;
+        float r2 = -zeta * w0 - d;
+        float e1 = expf(r1 * dt);
+        float e2 = expf(r2 * dt);
+        float inv = 1.0f / (r1 - r2);
+        m[0] = (r1 * e2 - r2 * e1) * inv;
+        m[1] = (e1 - e2) * inv;
+        m[2] = r1 * r2 * (e2 - e1) * inv;
+        m[3] = (r1 * e1 - r2 * e2) * inv;
+    }
+}
+
 void Animation_Spring_Init(SpringAnim_t *anim, float start_val, float stiffness, float damping) {
     if (!anim) return;
     anim->position = start_val;
@@ -530,81 +825,815 @@ float Animation_Spring_Update(SpringAnim_t *anim, float dt) {
         return anim->position;
     }
 
-    float force = -anim->stiffness * displacement - anim->damping * anim->velocity;
-    float acceleration = force; // mass = 1.0f
-    
-    // Semi-implicit Euler integration
-    anim->velocity += acceleration * dt;
-    anim->position += anim->velocity * dt;
+    // 解析解：任意 dt 下都是精确的，掉帧或大步长不会变慢或发散
+    float m[4];
+    Spring_Transition(anim->stiffness, anim->damping, dt, m);
+    float v = anim->velocity;
+    anim->velocity = m[2] * displacement + m[3] * v;
+    anim->position = anim->target + m[0] * displacement + m[1] * v;
     
     return anim->position;
 }
 
+// ----------------------------------------------------------------------------
+// Spring Pool Implementation
+// ----------------------------------------------------------------------------
+
+#if SPRING_POOL_FIXED
+typedef int32_t spring_t;                       // Q16.16
+#define SPRING_FROM_FLOAT(f) ((int32_t)((f) * 65536.0f + (((f) >= 0.0f) ? 0.5f : -0.5f)))
+#define SPRING_TO_FLOAT(v)   ((float)(v) * (1.0f / 65536.0f))
+#else
+typedef float spring_t;
+#define SPRING_FROM_FLOAT(f) (f)
+#define SPRING_TO_FLOAT(v)   (v)
+#endif
+
+#define SPRING_POOL_THRESHOLD 0.01f // 与 Animation_Spring_Init 的默认阈值一致
+
+static struct {
+    spring_t position[SPRING_POOL_SIZE];
+    spring_t velocity[SPRING_POOL_SIZE];
+    spring_t target[SPRING_POOL_SIZE];
+
+    uint8_t params[SPRING_POOL_SIZE]; // 所属参数组
+
+    // 参数组：刚度/阻尼相同的弹簧共用一份状态转移矩阵 (Spring_Transition)，按量化后的帧间隔缓存，
+    // 帧间隔落在同一档时直接复用；每个弹簧只引用一组，组数与弹簧数相同即不会用尽
+    spring_t m00[SPRING_POOL_SIZE], m01[SPRING_POOL_SIZE];
+    spring_t m10[SPRING_POOL_SIZE], m11[SPRING_POOL_SIZE];
+    uint16_t matrix_ticks[SPRING_POOL_SIZE]; // 矩阵对应的帧间隔 (1 / SPRING_POOL_DT_RES 秒，0 = 未计算)
+    float stiffness[SPRING_POOL_SIZE];
+    float damping[SPRING_POOL_SIZE];
+    uint8_t param_refs[SPRING_POOL_SIZE]; // 引用该组的弹簧数 (0 = 空闲)
+
+    uint8_t active[SPRING_POOL_SIZE]; // 活动弹簧索引 (紧凑排列)
+    uint8_t active_count;
+    uint32_t used_mask;               // 已分配
+    uint32_t active_mask;             // 在活动集合中
+
+    float dt_remainder;               // 量化时舍去的时间 (s)，计入下一帧
+} spring_pool;
+
+static inline bool SpringPool_Valid(SpringId_t id) {
+    return id >= 0 && id < SPRING_POOL_SIZE && (spring_pool.used_mask & (1u << id));
+}
+
+/**
+ * @brief 取得 (stiffness, damping) 对应的参数组，已有相同参数的组时直接共用
+ */
+static uint8_t SpringPool_AcquireParams(float stiffness, float damping) {
+    int free_set = -1;
+    for (int p = 0; p < SPRING_POOL_SIZE; p++) {
+        if (spring_pool.param_refs[p] == 0) {
+            if (free_set < 0) free_set = p;
+        } else if (spring_pool.stiffness[p] == stiffness && spring_pool.damping[p] == damping) {
+            spring_pool.param_refs[p]++;
+            return (uint8_t)p;
+        }
+    }
+    // 组数 = 弹簧数，调用方已释放旧组，一定有空闲组；矩阵在第一次推进时按当帧间隔计算
+    spring_pool.matrix_ticks[free_set] = 0;
+    spring_pool.stiffness[free_set] = stiffness;
+    spring_pool.damping[free_set] = damping;
+    spring_pool.param_refs[free_set] = 1;
+    return (uint8_t)free_set;
+}
+
+static void SpringPool_Activate(SpringId_t id) {
+    if (spring_pool.active_mask & (1u << id)) return;
+    spring_pool.active_mask |= (1u << id);
+    spring_pool.active[spring_pool.active_count++] = (uint8_t)id;
+}
+
+static void SpringPool_Deactivate(SpringId_t id) {
+    if (!(spring_pool.active_mask & (1u << id))) return;
+    spring_pool.active_mask &= ~(1u << id);
+    for (int i = 0; i < spring_pool.active_count; i++) {
+        if (spring_pool.active[i] == id) {
+            spring_pool.active[i] = spring_pool.active[--spring_pool.active_count];
+            break;
+        }
+    }
+}
+
+SpringId_t Animation_SpringPool_Add(float start_val, float stiffness, float damping) {
+    for (int id = 0; id < SPRING_POOL_SIZE; id++) {
+        if (spring_pool.used_mask & (1u << id)) continue;
+        spring_pool.used_mask |= (1u << id);
+        spring_pool.position[id] = SPRING_FROM_FLOAT(start_val);
+        spring_pool.target[id] = spring_pool.position[id];
+        spring_pool.velocity[id] = 0;
+        spring_pool.params[id] = SpringPool_AcquireParams(stiffness, damping);
+        return (SpringId_t)id;
+    }
+    return SPRING_INVALID;
+}
+
+void Animation_SpringPool_Remove(SpringId_t id) {
+    if (!SpringPool_Valid(id)) return;
+    SpringPool_Deactivate(id);
+    spring_pool.param_refs[spring_pool.params[id]]--;
+    spring_pool.used_mask &= ~(1u << id);
+}
+
+void Animation_SpringPool_SetTarget(SpringId_t id, float target) {
+    if (!SpringPool_Valid(id)) return;
+    spring_t t = SPRING_FROM_FLOAT(target);
+    if (t == spring_pool.target[id]) return; // 每帧重复设置相同目标不会唤醒已静止的弹簧
+    spring_pool.target[id] = t;
+    SpringPool_Activate(id);
+}
+
+void Animation_SpringPool_SetParams(SpringId_t id, float stiffness, float damping) {
+    if (!SpringPool_Valid(id)) return;
+    spring_pool.param_refs[spring_pool.params[id]]--;
+    spring_pool.params[id] = SpringPool_AcquireParams(stiffness, damping);
+}
+
+void Animation_SpringPool_Snap(SpringId_t id, float value) {
+    if (!SpringPool_Valid(id)) return;
+    spring_pool.position[id] = SPRING_FROM_FLOAT(value);
+    spring_pool.target[id] = spring_pool.position[id];
+    spring_pool.velocity[id] = 0;
+    SpringPool_Deactivate(id);
+}
+
+float Animation_SpringPool_GetPosition(SpringId_t id) {
+    return SpringPool_Valid(id) ? SPRING_TO_FLOAT(spring_pool.position[id]) : 0.0f;
+}
+
+float Animation_SpringPool_GetVelocity(SpringId_t id) {
+    return SpringPool_Valid(id) ? SPRING_TO_FLOAT(spring_pool.velocity[id]) : 0.0f;
+}
+
+float Animation_SpringPool_GetTarget(SpringId_t id) {
+    return SpringPool_Valid(id) ? SPRING_TO_FLOAT(spring_pool.target[id]) : 0.0f;
+}
+
+bool Animation_SpringPool_IsActive(SpringId_t id) {
+    return SpringPool_Valid(id) && (spring_pool.active_mask & (1u << id));
+}
+
+int Animation_SpringPool_ActiveCount(void) {
+    return spring_pool.active_count;
+}
 
 /**
- * @brief 运行一帧动画
+ * @brief 取参数组在 ticks 帧间隔下的状态转移矩阵 (与缓存的帧间隔相同时直接复用)
  */
-void Animation_Run(void) {
-    static uint32_t last_tick = 0;
-    static int frame_count = 0;
-    static int fps = 0;
-    
-    // 1. 清除显存
+static void SpringPool_PrepareMatrix(int p, uint16_t ticks) {
+    if (spring_pool.matrix_ticks[p] == ticks) return;
+    float m[4];
+    Spring_Transition(spring_pool.stiffness[p], spring_pool.damping[p], ticks * (1.0f / SPRING_POOL_DT_RES), m);
+    spring_pool.m00[p] = SPRING_FROM_FLOAT(m[0]);
+    spring_pool.m01[p] = SPRING_FROM_FLOAT(m[1]);
+    spring_pool.m10[p] = SPRING_FROM_FLOAT(m[2]);
+    spring_pool.m11[p] = SPRING_FROM_FLOAT(m[3]);
+    spring_pool.matrix_ticks[p] = ticks;
+}
+
+void Animation_SpringPool_Update(float dt) {
+    if (dt <= 0.0f) return;
+    const spring_t thr = SPRING_FROM_FLOAT(SPRING_POOL_THRESHOLD);
+
+    // 帧间隔量化为 1 / SPRING_POOL_DT_RES 秒的整数档，舍去的部分计入下一帧 (总时长不变，滞后不超过一档)；
+    // 每帧按整帧间隔做一次解析推进，掉帧时也只是一次矩阵乘法
+    float total = spring_pool.dt_remainder + dt;
+    int ticks = (int)(total * SPRING_POOL_DT_RES);
+    if (ticks > UINT16_MAX) ticks = UINT16_MAX;
+    spring_pool.dt_remainder = total - ticks * (1.0f / SPRING_POOL_DT_RES);
+    if (spring_pool.dt_remainder < 0.0f) spring_pool.dt_remainder = 0.0f;
+    if (ticks == 0) return;
+
+    for (int i = 0; i < spring_pool.active_count; ) {
+        int id = spring_pool.active[i];
+        int p = spring_pool.params[id];
+        SpringPool_PrepareMatrix(p, (uint16_t)ticks);
+
+        spring_t target = spring_pool.target[id];
+        spring_t x = spring_pool.position[id] - target;
+        spring_t v = spring_pool.velocity[id];
+#if SPRING_POOL_FIXED
+        // Q16 * Q16 = Q32，64 位累加避免大位移/高刚度时溢出
+        int64_t nx = (int64_t)spring_pool.m00[p] * x + (int64_t)spring_pool.m01[p] * v;
+        int64_t nv = (int64_t)spring_pool.m10[p] * x + (int64_t)spring_pool.m11[p] * v;
+        x = (int32_t)(nx >> 16);
+        v = (int32_t)(nv >> 16);
+#else
+        spring_t nx = spring_pool.m00[p] * x + spring_pool.m01[p] * v;
+        v = spring_pool.m10[p] * x + spring_pool.m11[p] * v;
+        x = nx;
+#endif
+
+        // 静止：吸附到目标并移出活动集合 (与被移出项交换，i 不前进)
+        if (x < thr && x > -thr && v < thr && v > -thr) {
+            spring_pool.position[id] = target;
+            spring_pool.velocity[id] = 0;
+            spring_pool.active_mask &= ~(1u << id);
+            spring_pool.active[i] = spring_pool.active[--spring_pool.active_count];
+            continue;
+        }
+
+        spring_pool.position[id] = target + x;
+        spring_pool.velocity[id] = v;
+        i++;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Tween Engine Implementation
+// ----------------------------------------------------------------------------
+
+#define Q16_ONE FASTMATH_Q16_ONE
+#define QMul    FastMath_MulQ16
+
+int32_t Animation_Ease(Easing_t ease, int32_t t) {
+    if (t <= 0) return 0;
+    if (t >= Q16_ONE) return Q16_ONE;
+
+    int32_t u = Q16_ONE - t; // 1 - t
+    switch (ease) {
+        case EASE_IN_QUAD:
+            return QMul(t, t);
+        case EASE_OUT_QUAD:
+            return Q16_ONE - QMul(u, u);
+        case EASE_IN_OUT_QUAD:
+            if (t < Q16_ONE / 2) return 2 * QMul(t, t);
+            return Q16_ONE - 2 * QMul(u, u);
+        case EASE_IN_CUBIC:
+            return QMul(QMul(t, t), t);
+        case EASE_OUT_CUBIC:
+            return Q16_ONE - QMul(QMul(u, u), u);
+        case EASE_IN_OUT_CUBIC:
+            if (t < Q16_ONE / 2) return 4 * QMul(QMul(t, t), t);
+            return Q16_ONE - 4 * QMul(QMul(u, u), u);
+        case EASE_OUT_BACK: {
+            // 1 + c3 (t-1)^3 + c1 (t-1)^2, c1 = 1.70158, c3 = c1 + 1
+            const int32_t c1 = 111515, c3 = 177051;
+            int32_t u2 = QMul(u, u);
+            return Q16_ONE - QMul(c3, QMul(u2, u)) + QMul(c1, u2);
+        }
+        case EASE_OUT_BOUNCE: {
+            // 分段抛物线 (n1 = 7.5625, d1 = 2.75)
+            const int32_t n1 = 495616;
+            if (t < 23831) {                       // 1 / d1
+                return QMul(n1, QMul(t, t));
+            } else if (t < 47663) {                // 2 / d1
+                t -= 35747;                        // 1.5 / d1
+                return QMul(n1, QMul(t, t)) + 49152;  // + 0.75
+            } else if (t < 59578) {                // 2.5 / d1
+                t -= 53620;                        // 2.25 / d1
+                return QMul(n1, QMul(t, t)) + 61440;  // + 0.9375
+            }
+            t -= 62557;                            // 2.625 / d1
+            return QMul(n1, QMul(t, t)) + 64512;      // + 0.984375
+        }
+        case EASE_LINEAR:
+        default:
+            return t;
+    }
+}
+
+typedef struct {
+    float *value;             // 被驱动的变量 (NULL = 空闲槽位)
+    float from, to;
+    float elapsed;            // 已经过时间 (含延迟)
+    float delay;
+    float inv_duration;       // 1 / duration
+    TweenCallback_t callback;
+    void *user;
+    uint8_t ease;
+    uint8_t generation;
+} Tween_t;
+
+static Tween_t tween_pool[TWEEN_POOL_SIZE];
+static uint8_t tween_active_count = 0;
+
+static Tween_t* Tween_Get(TweenId_t id) {
+    if (id < 0) return NULL;
+    int slot = id & 0xFF;
+    if (slot >= TWEEN_POOL_SIZE) return NULL;
+    Tween_t *tw = &tween_pool[slot];
+    if (!tw->value || tw->generation != (uint8_t)(id >> 8)) return NULL;
+    return tw;
+}
+
+static void Tween_Free(Tween_t *tw) {
+    tw->value = NULL;
+    tw->generation = (tw->generation + 1) & 0x7F;
+    tween_active_count--;
+}
+
+TweenId_t Animation_Tween_Start(float *value, float from, float to, float duration, float delay, Easing_t ease) {
+    if (!value) return TWEEN_INVALID;
+
+    for (int slot = 0; slot < TWEEN_POOL_SIZE; slot++) {
+        Tween_t *tw = &tween_pool[slot];
+        if (tw->value) continue;
+
+        tw->value = value;
+        tw->from = from;
+        tw->to = to;
+        tw->elapsed = 0.0f;
+        tw->delay = delay;
+        tw->inv_duration = (duration > 0.0f) ? 1.0f / duration : 0.0f;
+        tw->callback = NULL;
+        tw->user = NULL;
+        tw->ease = (uint8_t)ease;
+        tween_active_count++;
+
+        *value = from;
+        return (TweenId_t)((tw->generation << 8) | slot);
+    }
+
+    // 池已满：不做动画，直接到终值
+    *value = to;
+    return TWEEN_INVALID;
+}
+
+TweenId_t Animation_Tween_Stagger(float *values, int count, float from, float to,
+                                  float duration, float stagger, Easing_t ease) {
+    // 空闲槽位不够整个序列时一个也不启动，避免只启动前半段、完成回调挂不上
+    if (count > TWEEN_POOL_SIZE - tween_active_count) {
+        for (int i = 0; i < count; i++) values[i] = to;
+        return TWEEN_INVALID;
+    }
+
+    TweenId_t last = TWEEN_INVALID;
+    for (int i = 0; i < count; i++) {
+        last = Animation_Tween_Start(&values[i], from, to, duration, i * stagger, ease);
+    }
+    return last;
+}
+
+void Animation_Tween_OnComplete(TweenId_t id, TweenCallback_t callback, void *user) {
+    Tween_t *tw = Tween_Get(id);
+    if (!tw) return;
+    tw->callback = callback;
+    tw->user = user;
+}
+
+void Animation_Tween_Stop(TweenId_t id, bool jump_to_end) {
+    Tween_t *tw = Tween_Get(id);
+    if (!tw) return;
+
+    TweenCallback_t cb = tw->callback;
+    void *user = tw->user;
+    if (jump_to_end) *tw->value = tw->to;
+    Tween_Free(tw);
+    if (jump_to_end && cb) cb(user);
+}
+
+void Animation_Tween_StopValue(float *value) {
+    for (int slot = 0; slot < TWEEN_POOL_SIZE && tween_active_count > 0; slot++) {
+        if (tween_pool[slot].value == value) Tween_Free(&tween_pool[slot]);
+    }
+}
+
+bool Animation_Tween_IsActive(TweenId_t id) {
+    return Tween_Get(id) != NULL;
+}
+
+void Animation_Tween_Update(float dt) {
+    for (int slot = 0; slot < TWEEN_POOL_SIZE && tween_active_count > 0; slot++) {
+        Tween_t *tw = &tween_pool[slot];
+        if (!tw->value) continue;
+
+        tw->elapsed += dt;
+        float t = tw->elapsed - tw->delay;
+        if (t < 0.0f) continue; // 仍在延迟中，保持初值
+
+        float p = t * tw->inv_duration;
+        if (tw->inv_duration <= 0.0f || p >= 1.0f) {
+            *tw->value = tw->to;
+            // 先释放槽位再回调，回调中可以立即启动新的补间
+            TweenCallback_t cb = tw->callback;
+            void *user = tw->user;
+            Tween_Free(tw);
+            if (cb) cb(user);
+            continue;
+        }
+
+        int32_t e = Animation_Ease((Easing_t)tw->ease, (int32_t)(p * Q16_ONE));
+        *tw->value = tw->from + (tw->to - tw->from) * (e * (1.0f / Q16_ONE));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Sprite Player Implementation
+// ----------------------------------------------------------------------------
+
+void Animation_Sprite_Init(SpritePlayer_t *player, const MLCD_Sprite_t *sprite, uint8_t *frame_buf, bool loop) {
+    if (!player) return;
+    player->sprite = sprite;
+    player->frame_buf = frame_buf;
+    player->time = 0.0f;
+    player->frame = 0;
+    player->decoded = -1;
+    player->loop = loop;
+    player->playing = (sprite && sprite->frame_count > 0);
+}
+
+bool Animation_Sprite_Update(SpritePlayer_t *player, float dt) {
+    if (!player || !player->playing) return false;
+
+    const MLCD_Sprite_t *sprite = player->sprite;
+    float frame_time = sprite->frame_ms * 0.001f;
+    if (frame_time <= 0.0f) return true;
+
+    player->time += dt;
+    while (player->time >= frame_time) {
+        player->time -= frame_time;
+        if (player->frame + 1 < sprite->frame_count) {
+            player->frame++;
+        } else if (player->loop) {
+            player->frame = 0;
+        } else {
+            player->time = 0.0f;
+            player->playing = false;
+            break;
+        }
+    }
+    return player->playing;
+}
+
+void Animation_Sprite_Seek(SpritePlayer_t *player, uint16_t frame) {
+    if (!player || !player->sprite) return;
+    if (frame >= player->sprite->frame_count) frame = player->sprite->frame_count - 1;
+    player->frame = frame;
+    player->time = 0.0f;
+}
+
+/**
+ * @brief 将解码缓冲推进到当前帧
+ * 向前播放只需依次异或后续差分帧；回绕或后退时从最近的关键帧重新开始
+ */
+static void Sprite_DecodeTo(SpritePlayer_t *player) {
+    const MLCD_Sprite_t *sprite = player->sprite;
+    int target = player->frame;
+    int start = player->decoded + 1;
+
+    if (player->decoded < 0 || player->decoded > target) {
+        start = target;
+        while (start > 0 && (sprite->frames[start].flags & MLCD_FRAME_DELTA)) start--;
+    }
+
+    for (int i = start; i <= target; i++) {
+        const MLCD_Frame_t *f = &sprite->frames[i];
+        MLCD_UnpackImage(&f->image, player->frame_buf,
+                         (f->flags & MLCD_FRAME_DELTA) ? MLCD_UNPACK_XOR : MLCD_UNPACK_COPY);
+    }
+    player->decoded = target;
+}
+
+void Animation_Sprite_Draw(SpritePlayer_t *player, int x, int y, uint8_t color) {
+    if (!player || !player->sprite || player->sprite->frame_count == 0) return;
+
+    const MLCD_Sprite_t *sprite = player->sprite;
+    const MLCD_Frame_t *f = &sprite->frames[player->frame];
+
+    if (!player->frame_buf) {
+        // 无解码缓冲：关键帧直接从 Flash 流式绘制
+        if (f->flags & MLCD_FRAME_DELTA) return;
+        MLCD_DrawImageMasked(x, y, &f->image, f->mask, color);
+        return;
+    }
+
+    if (player->decoded != player->frame) Sprite_DecodeTo(player);
+
+    MLCD_Bitmap_t img = { player->frame_buf, sprite->w, sprite->h, sprite->stride, MLCD_ENC_RAW };
+    MLCD_DrawImageMasked(x, y, &img, f->mask, color);
+}
+
+// ----------------------------------------------------------------------------
+// Sprite Demo (加载动画)
+// ----------------------------------------------------------------------------
+
+static SpritePlayer_t demo_player;
+static uint8_t demo_frame_buf[SPRITE_SPINNER_STRIDE * SPRITE_SPINNER_H];
+static float demo_scroll;
+
+#define DEMO_SCROLL_SPEED 30.0f // 背景滚动速度 (px/s)
+
+void Animation_SpriteDemo_Init(void) {
+    Animation_Sprite_Init(&demo_player, &sprite_spinner, demo_frame_buf, true);
+    demo_scroll = 0.0f;
+}
+
+void Animation_SpriteDemo_Run(void) {
+    float dt = FrameClock_GetDt();
+    Animation_Sprite_Update(&demo_player, dt);
+
     MLCD_ClearBuffer();
 
-    // ... (existing box update logic)
-    
-    // 2. 更新位置和处理碰撞
-    for (int i = 0; i < BOX_COUNT; i++) {
-        // 更新位置
-        boxes[i].x += boxes[i].dx;
-        boxes[i].y += boxes[i].dy;
+    // 滚动的斜线背景，用来展示掩码透明效果
+    demo_scroll += DEMO_SCROLL_SPEED * dt;
+    if (demo_scroll >= 16.0f) demo_scroll -= 16.0f;
+    for (int i = -MLCD_HEIGHT; i < MLCD_WIDTH; i += 16) {
+        int x0 = i + (int)demo_scroll;
+        MLCD_DrawLine(x0, MLCD_HEIGHT - 1, x0 + MLCD_HEIGHT - 1, 0, MLCD_COLOR_BLACK);
+    }
+
+    Animation_Sprite_Draw(&demo_player, (MLCD_WIDTH - SPRITE_SPINNER_W) / 2,
+                          (MLCD_HEIGHT - SPRITE_SPINNER_H) / 2, MLCD_COLOR_BLACK);
+    ShowFPS();
+
+    extern bool setting_dark_mode;
+    if (setting_dark_mode) {
+       MLCD_InvertRect(0, 0, MLCD_WIDTH, MLCD_HEIGHT);
+    }
+
+    MLCD_Refresh();
+}
+
+/**
+ * @brief 均匀网格 (方块碰撞与粒子碰撞共用)
+ * 对象登记到其包围盒覆盖的每个单元，单元 c 的对象为 items[start[c] .. start[c + 1])
+ */
+typedef struct {
+    uint8_t shift;      // 单元边长 = 1 << shift 像素
+    uint8_t w, h;       // 单元列数 / 行数
+    uint16_t capacity;  // items 容量 (条目总数上限)
+    uint16_t *start;    // w * h + 1 个
+    uint16_t *fill;     // w * h 个，重建时的计数 / 写入游标
+    uint8_t *items;     // 对象索引
+} UniformGrid_t;
+
+// 取对象 i 的包围盒 (像素，含端点)，返回 false 表示该对象不登记
+typedef bool (*UniformGrid_BoundsFunc)(int i, int *x0, int *y0, int *x1, int *y1);
+
+// 像素坐标所在单元 (超出网格时取最近的边缘单元)
+static int UniformGrid_Cell(const UniformGrid_t *g, int x, int y) {
+    int cx = x >> g->shift, cy = y >> g->shift;
+    if (cx < 0) cx = 0; else if (cx > g->w - 1) cx = g->w - 1;
+    if (cy < 0) cy = 0; else if (cy > g->h - 1) cy = g->h - 1;
+    return cy * g->w + cx;
+}
 
-        // 2.1 边界碰撞检测
-        if (boxes[i].x <= 0) {
-            boxes[i].x = 0;
-            boxes[i].dx = -boxes[i].dx;
-        } else if (boxes[i].x + boxes[i].size >= MLCD_WIDTH - 1) {
-            boxes[i].x = MLCD_WIDTH - 1 - boxes[i].size;
-            boxes[i].dx = -boxes[i].dx;
+/**
+ * @brief 重建网格 (计数排序：统计 -> 前缀和 -> 填充)
+ * 包围盒完全在网格外的对象不登记；登记后条目总数会超过 capacity 的对象被跳过
+ */
+static void UniformGrid_Build(const UniformGrid_t *g, int count, UniformGrid_BoundsFunc bounds) {
+    int cells = g->w * g->h;
+    memset(g->fill, 0, cells * sizeof(g->fill[0]));
+
+    // 第 0 遍统计每个单元的条目数，第 1 遍按相同的遍历与跳过条件填充
+    for (int pass = 0; pass < 2; pass++) {
+        int total = 0;
+        for (int i = 0; i < count; i++) {
+            int x0, y0, x1, y1;
+            if (!bounds(i, &x0, &y0, &x1, &y1)) continue;
+            int cx0 = x0 >> g->shift, cx1 = x1 >> g->shift;
+            int cy0 = y0 >> g->shift, cy1 = y1 >> g->shift;
+            if (cx0 < 0) cx0 = 0;
+            if (cy0 < 0) cy0 = 0;
+            if (cx1 > g->w - 1) cx1 = g->w - 1;
+            if (cy1 > g->h - 1) cy1 = g->h - 1;
+            if (cx0 > cx1 || cy0 > cy1) continue;
+
+            int n = (cx1 - cx0 + 1) * (cy1 - cy0 + 1);
+            if (total + n > g->capacity) continue;
+            total += n;
+            for (int cy = cy0; cy <= cy1; cy++) {
+                for (int cx = cx0; cx <= cx1; cx++) {
+                    int c = cy * g->w + cx;
+                    if (pass == 0) g->fill[c]++;
+                    else g->items[g->fill[c]++] = (uint8_t)i;
+                }
+            }
         }
 
-        if (boxes[i].y <= 0) {
-            boxes[i].y = 0;
-            boxes[i].dy = -boxes[i].dy;
-        } else if (boxes[i].y + boxes[i].size >= MLCD_HEIGHT - 1) {
-            boxes[i].y = MLCD_HEIGHT - 1 - boxes[i].size;
-            boxes[i].dy = -boxes[i].dy;
+        if (pass == 0) {
+            // 前缀和得到每个单元的起点，fill 改作写入游标
+            int sum = 0;
+            for (int c = 0; c < cells; c++) {
+                g->start[c] = (uint16_t)sum;
+                sum += g->fill[c];
+                g->fill[c] = g->start[c];
+            }
+            g->start[cells] = (uint16_t)sum;
         }
     }
+}
 
-    // 2.2 方块间碰撞检测 (简单的弹性碰撞)
-    for (int i = 0; i < BOX_COUNT; i++) {
-        for (int j = i + 1; j < BOX_COUNT; j++) {
-            if (CheckCollision(&boxes[i], &boxes[j])) {
-                // 简单的动量交换模拟：交换速度
-                int temp_dx = boxes[i].dx;
-                int temp_dy = boxes[i].dy;
-                boxes[i].dx = boxes[j].dx;
-                boxes[i].dy = boxes[j].dy;
-                boxes[j].dx = temp_dx;
-                boxes[j].dy = temp_dy;
-
-                // 简单的分离逻辑
-                if (boxes[i].x < boxes[j].x) boxes[i].x -= 2; else boxes[i].x += 2;
-                if (boxes[i].y < boxes[j].y) boxes[i].y -= 2; else boxes[i].y += 2;
+// 方块碰撞网格：16x16 像素单元，方块按本步的扫掠包围盒登记到覆盖的每个单元
+#define BOX_GRID_SHIFT 4
+#define BOX_GRID_W     (MLCD_WIDTH >> BOX_GRID_SHIFT)
+#define BOX_GRID_H     (MLCD_HEIGHT >> BOX_GRID_SHIFT)
+#define BOX_GRID_ITEMS (BOX_MAX * 4)
+#define BOX_TOI_ONE    (1 << BOX_FRAC_BITS) // 碰撞时间 (Q8，1.0 = 整步)
+#define BOX_GRID_MIN   24 // 少于该数量时直接逐对检查
+
+static uint16_t box_grid_start[BOX_GRID_W * BOX_GRID_H + 1];
+static uint16_t box_grid_fill[BOX_GRID_W * BOX_GRID_H];
+static uint8_t box_grid_items[BOX_GRID_ITEMS];
+static const UniformGrid_t box_grid = {
+    BOX_GRID_SHIFT, BOX_GRID_W, BOX_GRID_H, BOX_GRID_ITEMS, box_grid_start, box_grid_fill, box_grid_items
+};
+static int32_t box_vx0[BOX_MAX], box_vy0[BOX_MAX]; // 本步开始时的速度 (积分与扫掠检测使用)
+static int16_t box_toi[BOX_MAX];                    // 本步最早碰撞时间 (Q8)
+
+// 扫掠包围盒 (像素，含起止位置)
+static bool Box_SweptBounds(int i, int *x0, int *y0, int *x1, int *y1) {
+    const Box *b = &boxes[i];
+    int32_t ax = b->x, bx = b->x + box_vx0[i];
+    int32_t ay = b->y, by = b->y + box_vy0[i];
+    *x0 = (ax < bx ? ax : bx) >> BOX_FRAC_BITS;
+    *y0 = (ay < by ? ay : by) >> BOX_FRAC_BITS;
+    *x1 = ((ax > bx ? ax : bx) >> BOX_FRAC_BITS) + b->size;
+    *y1 = ((ay > by ? ay : by) >> BOX_FRAC_BITS) + b->size;
+    return true;
+}
+
+/**
+ * @brief 扫掠 AABB：a 相对 b 以本步速度运动时的最早接触时间
+ * @param axis 输出接触面的法线轴 (0 = x, 1 = y)
+ * @return 接触时间 (Q8，0 ~ BOX_TOI_ONE)，本步内不接触返回 -1
+ */
+static int Box_SweptTOI(int a, int b, int *axis) {
+    int32_t sa = boxes[a].size << BOX_FRAC_BITS, sb = boxes[b].size << BOX_FRAC_BITS;
+    int32_t v[2] = { box_vx0[a] - box_vx0[b], box_vy0[a] - box_vy0[b] };
+    int32_t pa[2] = { boxes[a].x, boxes[a].y }, pb[2] = { boxes[b].x, boxes[b].y };
+    int32_t t_enter = INT32_MIN, t_exit = INT32_MAX;
+
+    for (int k = 0; k < 2; k++) {
+        // 沿该轴的间隙：进入 = 前沿相遇，离开 = 后沿分开
+        int32_t gap_in, gap_out;
+        if (v[k] > 0) {
+            gap_in = pb[k] - (pa[k] + sa);
+            gap_out = (pb[k] + sb) - pa[k];
+        } else if (v[k] < 0) {
+            gap_in = pa[k] - (pb[k] + sb);
+            gap_out = (pa[k] + sa) - pb[k];
+        } else {
+            if (pa[k] + sa <= pb[k] || pb[k] + sb <= pa[k]) return -1; // 该轴不重叠且不靠近
+            continue;
+        }
+        int32_t speed = abs(v[k]);
+        int32_t t0 = (gap_in << BOX_FRAC_BITS) / speed;
+        int32_t t1 = (gap_out << BOX_FRAC_BITS) / speed;
+        if (t0 > t_enter) { t_enter = t0; *axis = k; }
+        if (t1 < t_exit) t_exit = t1;
+    }
+
+    if (t_enter < 0 || t_enter > BOX_TOI_ONE || t_enter >= t_exit) return -1;
+    return (int)t_enter;
+}
+
+// 等质量弹性碰撞：沿法线轴交换速度分量 (仅在相互接近时)
+static void Box_Bounce(int a, int b, int axis) {
+    int32_t *va = axis ? &boxes[a].dy : &boxes[a].dx;
+    int32_t *vb = axis ? &boxes[b].dy : &boxes[b].dx;
+    int32_t pa = axis ? boxes[a].y : boxes[a].x;
+    int32_t pb = axis ? boxes[b].y : boxes[b].x;
+    int32_t closing = (pa < pb) ? (*va - *vb) : (*vb - *va);
+    if (closing <= 0) return;
+    int32_t t = *va; *va = *vb; *vb = t;
+}
+
+/**
+ * @brief 处理一对候选方块
+ * 已重叠：沿穿透较浅的轴各推开一半 (位置修正，不会粘连或穿透)，并在接近时反弹；
+ * 未重叠：扫掠 AABB 求本步内的接触时间，两个方块本步只前进到接触点并反弹
+ */
+static void Boxes_Collide(int a, int b) {
+    Box *A = &boxes[a], *B = &boxes[b];
+    int32_t sa = A->size << BOX_FRAC_BITS, sb = B->size << BOX_FRAC_BITS;
+
+    if (CheckCollision(A, B)) {
+        int32_t px = (A->x < B->x) ? (A->x + sa - B->x) : (B->x + sb - A->x);
+        int32_t py = (A->y < B->y) ? (A->y + sa - B->y) : (B->y + sb - A->y);
+        int axis = (py < px);
+        int32_t pen = axis ? py : px;
+        int32_t half = pen >> 1, rest = pen - half;
+        int32_t *ca = axis ? &A->y : &A->x, *cb = axis ? &B->y : &B->x;
+        if (*ca < *cb) { *ca -= half; *cb += rest; } else { *ca += half; *cb -= rest; }
+        Box_Bounce(a, b, axis);
+        return;
+    }
+
+    int axis = 0;
+    int t = Box_SweptTOI(a, b, &axis);
+    if (t < 0) return;
+    if (t < box_toi[a]) box_toi[a] = (int16_t)t;
+    if (t < box_toi[b]) box_toi[b] = (int16_t)t;
+    Box_Bounce(a, b, axis);
+}
+
+// 粗筛得到的候选方块对回调 (a < b)
+typedef void (*Boxes_PairFunc)(int a, int b);
+
+/**
+ * @brief 粗筛：对扫掠包围盒相交的每一对方块调用一次 pair (需先填好 box_vx0 / box_vy0)
+ * 同一对方块可能同时登记在多个单元中，只在二者包围盒交集的左上角所在单元处理一次
+ */
+static void Boxes_BroadPhase(Boxes_PairFunc pair) {
+    if (box_count < BOX_GRID_MIN) {
+        // 方块很少时网格的建表开销大于逐对检查
+        for (int a = 0; a < box_count; a++) {
+            for (int b = a + 1; b < box_count; b++) {
+                int ax0, ay0, ax1, ay1, bx0, by0, bx1, by1;
+                Box_SweptBounds(a, &ax0, &ay0, &ax1, &ay1);
+                Box_SweptBounds(b, &bx0, &by0, &bx1, &by1);
+                if (ax1 < bx0 || bx1 < ax0 || ay1 < by0 || by1 < ay0) continue;
+                pair(a, b);
             }
         }
+        return;
     }
 
-    // 3. 绘制所有方块
-    for (int i = 0; i < BOX_COUNT; i++) {
-        for (int k = 0; k < boxes[i].size; k++) {
-            MLCD_DrawLine(boxes[i].x, boxes[i].y + k, 
-                          boxes[i].x + boxes[i].size, boxes[i].y + k, 
-                          MLCD_COLOR_BLACK);
+    // 超出容量的方块本步不参与碰撞
+    UniformGrid_Build(&box_grid, box_count, Box_SweptBounds);
+
+    for (int c = 0; c < BOX_GRID_W * BOX_GRID_H; c++) {
+        int start = box_grid_start[c], end = box_grid_start[c + 1];
+        for (int m = start; m < end; m++) {
+            int a = box_grid_items[m];
+            int ax0, ay0, ax1, ay1;
+            Box_SweptBounds(a, &ax0, &ay0, &ax1, &ay1);
+
+            for (int n = m + 1; n < end; n++) {
+                int b = box_grid_items[n];
+                int bx0, by0, bx1, by1;
+                Box_SweptBounds(b, &bx0, &by0, &bx1, &by1);
+                if (ax1 < bx0 || bx1 < ax0 || ay1 < by0 || by1 < ay0) continue;
+
+                // 去重：交集左上角所在单元
+                int ox = (ax0 > bx0 ? ax0 : bx0), oy = (ay0 > by0 ? ay0 : by0);
+                if (UniformGrid_Cell(&box_grid, ox, oy) != c) continue;
+
+                pair(a, b);
+            }
+        }
+    }
+}
+
+/**
+ * @brief 方块物理推进一步 (粗筛 -> 扫掠 AABB -> 移动 -> 边界反弹)
+ */
+static void Boxes_Step(void) {
+    for (int i = 0; i < box_count; i++) {
+        box_vx0[i] = boxes[i].dx;
+        box_vy0[i] = boxes[i].dy;
+        box_toi[i] = BOX_TOI_ONE;
+    }
+    Boxes_BroadPhase(Boxes_Collide);
+
+    for (int i = 0; i < box_count; i++) {
+        Box *b = &boxes[i];
+        // 按本步开始时的速度前进到最早接触时刻 (无碰撞时为整步)
+        b->x += (box_vx0[i] * box_toi[i]) >> BOX_FRAC_BITS;
+        b->y += (box_vy0[i] * box_toi[i]) >> BOX_FRAC_BITS;
+
+        // 边界碰撞：夹回屏幕内，只在朝墙运动时反向
+        int32_t max_x = (MLCD_WIDTH - 1 - b->size) << BOX_FRAC_BITS;
+        int32_t max_y = (MLCD_HEIGHT - 1 - b->size) << BOX_FRAC_BITS;
+        if (b->x <= 0) {
+            b->x = 0;
+            if (b->dx < 0) b->dx = -b->dx;
+        } else if (b->x >= max_x) {
+            b->x = max_x;
+            if (b->dx > 0) b->dx = -b->dx;
+        }
+        if (b->y <= 0) {
+            b->y = 0;
+            if (b->dy < 0) b->dy = -b->dy;
+        } else if (b->y >= max_y) {
+            b->y = max_y;
+            if (b->dy > 0) b->dy = -b->dy;
         }
     }
+}
+
+/**
+ * @brief 运行一帧动画
+ */
+void Animation_Run(void) {
+    // 1. 清除显存
+    MLCD_ClearBuffer();
+
+    // 2. 更新位置和处理碰撞
+    // 方块速度以 "像素/步" 表示，物理按固定 60Hz 步长推进，渲染帧率变化不影响运动速度
+    static float step_accum = 0.0f;
+    step_accum += FrameClock_GetDt();
+    int steps = (int)(step_accum * BOX_STEP_HZ);
+    step_accum -= steps * (1.0f / BOX_STEP_HZ);
+    if (steps > BOX_MAX_STEPS) steps = BOX_MAX_STEPS;
+
+    uint32_t t0 = FrameClock_Micros();
+    for (int s = 0; s < steps; s++) {
+        Boxes_Step();
+    }
+    static uint32_t box_step_us = 0;
+    if (steps > 0) box_step_us = (box_step_us * 7 + (FrameClock_Micros() - t0) / steps) / 8;
+
+    // 3. 绘制所有方块
+    for (int i = 0; i < box_count; i++) {
+        MLCD_FillRect(boxes[i].x >> BOX_FRAC_BITS, boxes[i].y >> BOX_FRAC_BITS,
+                      boxes[i].size + 1, boxes[i].size, MLCD_COLOR_BLACK);
+    }
 
     // 4. 绘制外框
     MLCD_DrawLine(0, 0, 127, 0, MLCD_COLOR_BLACK);
@@ -612,19 +1641,281 @@ void Animation_Run(void) {
     MLCD_DrawLine(127, 127, 0, 127, MLCD_COLOR_BLACK);
     MLCD_DrawLine(0, 127, 0, 0, MLCD_COLOR_BLACK);
     
-    // 5. 计算并显示 FPS
-    frame_count++;
-    uint32_t current_tick = HAL_GetTick();
-    if (current_tick - last_tick >= 1000) {
-        fps = frame_count;
-        frame_count = 0;
-        last_tick = current_tick;
-    }
-    
-    char fps_str[16];
-    sprintf(fps_str, "FPS: %d", fps);
-    MLCD_DrawString(2, 2, fps_str, MLCD_COLOR_BLACK);
+    // 5. 显示 FPS / 方块数 / 单步物理耗时
+    char buf[16];
+    ShowFPS();
+    buf[0] = 'N'; buf[1] = ':';
+    MLCD_FormatInt(buf + 2, sizeof(buf) - 2, box_count);
+    MLCD_DrawString(2, 11, buf, MLCD_COLOR_BLACK);
+    int len = MLCD_FormatInt(buf, sizeof(buf) - 2, (int32_t)box_step_us);
+    memcpy(buf + len, "us", 3);
+    MLCD_DrawString(2, 20, buf, MLCD_COLOR_BLACK);
     
     // 6. 刷新显存
     MLCD_Refresh();
 }
+
+// ----------------------------------------------------------------------------
+// Particle System Implementation
+// ----------------------------------------------------------------------------
+
+#define PARTICLE_GRID_W     (MLCD_WIDTH >> PARTICLE_GRID_SHIFT)
+#define PARTICLE_GRID_H     (MLCD_HEIGHT >> PARTICLE_GRID_SHIFT)
+#define PARTICLE_GRID_ITEMS 1024 // 网格中 (单元, 矩形) 条目总数上限
+#define PARTICLE_EDGE       ((MLCD_WIDTH << PARTICLE_FRAC_BITS) - 1)
+#define PARTICLE_FLOOR      ((MLCD_HEIGHT << PARTICLE_FRAC_BITS) - 1)
+
+static struct {
+    // 结构数组：积分循环顺序访问各数组，存活粒子始终紧凑排列在 [0, count)
+    int16_t x[PARTICLE_MAX], y[PARTICLE_MAX];   // Q8.8 像素
+    int16_t vx[PARTICLE_MAX], vy[PARTICLE_MAX]; // Q8.8 像素/步
+    uint8_t life[PARTICLE_MAX];                 // 剩余步数
+    int count;
+
+    int16_t gravity;     // Q8.8 像素/步²
+    int16_t restitution; // Q8.8
+    uint32_t rng;
+
+    // 碰撞网格：单元 c 覆盖的矩形为 grid_items[grid_start[c] .. grid_start[c + 1])
+    ParticleCollider_t colliders[PARTICLE_MAX_COLLIDERS];
+    uint16_t grid_start[PARTICLE_GRID_W * PARTICLE_GRID_H + 1];
+    uint8_t grid_items[PARTICLE_GRID_ITEMS];
+    uint16_t grid_fill[PARTICLE_GRID_W * PARTICLE_GRID_H];
+} particles = { .gravity = 8, .restitution = 154, .rng = 0x2545F491u };
+
+static const UniformGrid_t particle_grid = {
+    PARTICLE_GRID_SHIFT, PARTICLE_GRID_W, PARTICLE_GRID_H, PARTICLE_GRID_ITEMS,
+    particles.grid_start, particles.grid_fill, particles.grid_items
+};
+
+// xorshift32：比 rand() 快，且不影响其他模块的随机序列
+static inline uint32_t Particle_Rand(void) {
+    uint32_t r = particles.rng;
+    r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+    return particles.rng = r;
+}
+
+static inline int16_t Particle_Q8(float v) {
+    return (int16_t)(v * PARTICLE_ONE + ((v >= 0.0f) ? 0.5f : -0.5f));
+}
+
+void Animation_Particles_Clear(void) {
+    particles.count = 0;
+}
+
+int Animation_Particles_Emit(int count, float x, float y, float vx, float vy, float spread, uint8_t life) {
+    if (count > PARTICLE_MAX - particles.count) count = PARTICLE_MAX - particles.count;
+    if (count <= 0 || life == 0) return 0;
+
+    int16_t qx = Particle_Q8(x), qy = Particle_Q8(y);
+    int16_t qvx = Particle_Q8(vx), qvy = Particle_Q8(vy);
+    uint32_t range = (uint32_t)Particle_Q8(spread) * 2 + 1;
+    uint32_t life_var = life / 4 + 1;
+
+    for (int k = 0; k < count; k++) {
+        int i = particles.count++;
+        particles.x[i] = qx;
+        particles.y[i] = qy;
+        particles.vx[i] = (int16_t)(qvx + (int32_t)(Particle_Rand() % range) - (int32_t)(range / 2));
+        particles.vy[i] = (int16_t)(qvy + (int32_t)(Particle_Rand() % range) - (int32_t)(range / 2));
+        particles.life[i] = (uint8_t)(life - Particle_Rand() % life_var);
+        if (particles.life[i] == 0) particles.life[i] = 1;
+    }
+    return count;
+}
+
+void Animation_Particles_SetPhysics(float gravity, float restitution) {
+    particles.gravity = Particle_Q8(gravity);
+    particles.restitution = Particle_Q8(restitution);
+}
+
+// 碰撞矩形的像素范围，空矩形不登记
+static bool Particle_ColliderBounds(int i, int *x0, int *y0, int *x1, int *y1) {
+    const ParticleCollider_t *r = &particles.colliders[i];
+    *x0 = r->x; *x1 = r->x + r->w - 1;
+    *y0 = r->y; *y1 = r->y + r->h - 1;
+    return r->w > 0 && r->h > 0;
+}
+
+/**
+ * @brief 设置碰撞矩形并重建均匀网格
+ * 矩形写入其覆盖的每个 8x8 单元；条目超过 PARTICLE_GRID_ITEMS 的矩形被忽略
+ */
+void Animation_Particles_SetColliders(const ParticleCollider_t *rects, int count) {
+    if (count > PARTICLE_MAX_COLLIDERS) count = PARTICLE_MAX_COLLIDERS;
+    memcpy(particles.colliders, rects, count * sizeof(ParticleCollider_t));
+    UniformGrid_Build(&particle_grid, count, Particle_ColliderBounds);
+}
+
+/**
+ * @brief 粒子与所在单元的矩形碰撞
+ * 按上一步的位置 (old_x, old_y) 判断从哪一侧进入：x 方向原本在矩形外则水平反弹，否则垂直反弹；
+ * 粒子退回该轴上一步的位置 (矩形自身移动导致仍在内部时，推到最近的上/下边，贴地的矩形只推到上边)。
+ * 上一步的位置由调用方传入，而不是用速度反推：速度可能已被墙面反弹改写
+ */
+static void Particle_Collide(int32_t *px, int32_t *py, int32_t *pvx, int32_t *pvy, int32_t old_x, int32_t old_y) {
+    int sx = *px >> PARTICLE_FRAC_BITS, sy = *py >> PARTICLE_FRAC_BITS;
+    int c = (sy >> PARTICLE_GRID_SHIFT) * PARTICLE_GRID_W + (sx >> PARTICLE_GRID_SHIFT);
+    int end = particles.grid_start[c + 1];
+
+    for (int k = particles.grid_start[c]; k < end; k++) {
+        const ParticleCollider_t *r = &particles.colliders[particles.grid_items[k]];
+        if (sx < r->x || sx >= r->x + r->w || sy < r->y || sy >= r->y + r->h) continue;
+
+        int ox = old_x >> PARTICLE_FRAC_BITS;
+        int oy = old_y >> PARTICLE_FRAC_BITS;
+        if (ox < r->x || ox >= r->x + r->w) {
+            *px = old_x;
+            *pvx = -((*pvx * particles.restitution) >> PARTICLE_FRAC_BITS);
+        } else if (oy < r->y || oy >= r->y + r->h) {
+            *py = old_y;
+            *pvy = -((*pvy * particles.restitution) >> PARTICLE_FRAC_BITS);
+        } else {
+            bool up = (sy - r->y) < (r->y + r->h - sy) || r->y + r->h >= MLCD_HEIGHT;
+            *py = up ? ((r->y << PARTICLE_FRAC_BITS) - 1) : ((r->y + r->h) << PARTICLE_FRAC_BITS);
+            *pvy = up ? -(abs(*pvy) >> 1) : (abs(*pvy) >> 1);
+        }
+        return; // 每步最多处理一个矩形
+    }
+}
+
+void Animation_Particles_Step(void) {
+    int32_t g = particles.gravity, e = particles.restitution;
+    bool grid = particles.grid_start[PARTICLE_GRID_W * PARTICLE_GRID_H] > 0;
+
+    for (int i = 0; i < particles.count; ) {
+        if (--particles.life[i] == 0) {
+            // 回收：用最后一个粒子填补空位，保持数组紧凑
+            int last = --particles.count;
+            particles.x[i] = particles.x[last];
+            particles.y[i] = particles.y[last];
+            particles.vx[i] = particles.vx[last];
+            particles.vy[i] = particles.vy[last];
+            particles.life[i] = particles.life[last];
+            continue;
+        }
+
+        // 半隐式欧拉：先更新速度再更新位置 (32 位中间值，防止越界回绕)
+        int32_t vx = particles.vx[i];
+        int32_t vy = particles.vy[i] + g;
+        int32_t x = particles.x[i] + vx;
+        int32_t y = particles.y[i] + vy;
+
+        // 左右墙与地面反弹，顶部敞开 (Q8.8 下限 -128 像素)
+        if (x < 0) {
+            x = -x;
+            vx = -((vx * e) >> PARTICLE_FRAC_BITS);
+        } else if (x > PARTICLE_EDGE) {
+            x = PARTICLE_EDGE;
+            vx = -((vx * e) >> PARTICLE_FRAC_BITS);
+        }
+        if (y > PARTICLE_FLOOR) {
+            y = PARTICLE_FLOOR;
+            vy = -((vy * e) >> PARTICLE_FRAC_BITS);
+            vx -= vx >> 3; // 地面摩擦
+        } else if (y < INT16_MIN) {
+            y = INT16_MIN;
+            vy = 0;
+        }
+
+        if (grid && y >= 0) Particle_Collide(&x, &y, &vx, &vy, particles.x[i], particles.y[i]);
+
+        particles.x[i] = (int16_t)x;
+        particles.y[i] = (int16_t)y;
+        particles.vx[i] = (int16_t)vx;
+        particles.vy[i] = (int16_t)vy;
+        i++;
+    }
+}
+
+void Animation_Particles_Draw(uint8_t color) {
+    MLCD_DrawPoints(particles.x, particles.y, particles.count, PARTICLE_FRAC_BITS, color);
+}
+
+int Animation_Particles_Count(void) {
+    return particles.count;
+}
+
+// ----------------------------------------------------------------------------
+// Particle Demo (喷泉 + 弹跳方块)
+// ----------------------------------------------------------------------------
+
+#define PARTICLE_DEMO_LIFE   180  // 粒子寿命 (步，约 3 秒)
+#define PARTICLE_DEMO_START  1024 // 初始目标粒子数
+
+static int particle_demo_target = PARTICLE_DEMO_START;
+static uint32_t particle_demo_us;  // 模拟 + 绘制耗时 (us，滑动平均)
+static float particle_demo_accum;
+
+void Animation_ParticleDemo_Init(void) {
+    Animation_Boxes_SetCount(BOX_COUNT);
+    Animation_Particles_Clear();
+    Animation_Particles_SetPhysics(0.03f, 0.6f);
+    particle_demo_accum = 0.0f;
+    particle_demo_us = 0;
+}
+
+void Animation_ParticleDemo_Adjust(int delta) {
+    particle_demo_target += delta * PARTICLE_DEMO_STEP;
+    if (particle_demo_target < PARTICLE_DEMO_STEP) particle_demo_target = PARTICLE_DEMO_STEP;
+    if (particle_demo_target > PARTICLE_MAX) particle_demo_target = PARTICLE_MAX;
+}
+
+void Animation_ParticleDemo_Run(void) {
+    MLCD_ClearBuffer();
+
+    uint32_t t0 = FrameClock_Micros();
+
+    // 与方块演示相同的固定步频
+    particle_demo_accum += FrameClock_GetDt();
+    int steps = (int)(particle_demo_accum * BOX_STEP_HZ);
+    particle_demo_accum -= steps * (1.0f / BOX_STEP_HZ);
+    if (steps > BOX_MAX_STEPS) steps = BOX_MAX_STEPS;
+
+    ParticleCollider_t rects[BOX_COUNT];
+    for (int s = 0; s < steps; s++) {
+        Boxes_Step();
+        for (int i = 0; i < BOX_COUNT; i++) {
+            rects[i] = (ParticleCollider_t){ (int16_t)(boxes[i].x >> BOX_FRAC_BITS), (int16_t)(boxes[i].y >> BOX_FRAC_BITS),
+                                             (int16_t)(boxes[i].size + 1), (int16_t)boxes[i].size };
+        }
+        Animation_Particles_SetColliders(rects, BOX_COUNT);
+
+        // 两个喷口交替发射，发射速率使粒子数稳定在目标附近
+        int emit = particle_demo_target * 5 / (PARTICLE_DEMO_LIFE * 4) + 1;
+        if (emit > particle_demo_target - Animation_Particles_Count()) {
+            emit = particle_demo_target - Animation_Particles_Count();
+        }
+        if (emit > 0) {
+            float x = (s & 1) ? MLCD_WIDTH * 0.25f : MLCD_WIDTH * 0.75f;
+            Animation_Particles_Emit(emit, x, MLCD_HEIGHT - 2, 0.0f, -2.6f, 0.6f, PARTICLE_DEMO_LIFE);
+        }
+        Animation_Particles_Step();
+    }
+
+    for (int i = 0; i < BOX_COUNT; i++) {
+        MLCD_DrawRect(boxes[i].x >> BOX_FRAC_BITS, boxes[i].y >> BOX_FRAC_BITS,
+                      boxes[i].size + 1, boxes[i].size, MLCD_COLOR_BLACK);
+    }
+    Animation_Particles_Draw(MLCD_COLOR_BLACK);
+
+    uint32_t us = FrameClock_Micros() - t0;
+    particle_demo_us = (particle_demo_us * 7 + us) / 8;
+
+    // 统计：FPS / 粒子数 / 模拟 + 绘制耗时
+    char buf[16];
+    ShowFPS();
+    buf[0] = 'N'; buf[1] = ':';
+    MLCD_FormatInt(buf + 2, sizeof(buf) - 2, Animation_Particles_Count());
+    MLCD_DrawString(2, 11, buf, MLCD_COLOR_BLACK);
+    int len = MLCD_FormatInt(buf, sizeof(buf) - 2, (int32_t)particle_demo_us);
+    memcpy(buf + len, "us", 3);
+    MLCD_DrawString(2, 20, buf, MLCD_COLOR_BLACK);
+
+    extern bool setting_dark_mode;
+    if (setting_dark_mode) {
+       MLCD_InvertRect(0, 0, MLCD_WIDTH, MLCD_HEIGHT);
+    }
+
+    MLCD_Refresh();
+}
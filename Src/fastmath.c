@@ -0,0 +1,133 @@
+//
+// 快速数学：查表 sin/cos、定点角度与快速倒数/平方根
+//
+
+#include "fastmath.h"
+#include <string.h> // for memcpy
+#include <math.h>   // for fmodf, floorf
+
+// sin(i / FASTMATH_SIN_STEPS * pi / 2) * 32768，i = 0..FASTMATH_SIN_STEPS (含端点，插值时免去边界判断)
+static const uint16_t sin_table[FASTMATH_SIN_STEPS + 1] = {
+        0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,
+     2411,  2611,  2811,  3012,  3212,  3412,  3612,  3812,  4011,  4211,  4410,  4609,
+     4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,  6393,  6590,  6787,  6983,
+     7180,  7376,  7571,  7767,  7962,  8157,  8351,  8546,  8740,  8933,  9127,  9319,
+     9512,  9704,  9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605,
+    11793, 11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828,
+    14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269, 15447, 15624, 15800, 15976,
+    16151, 16326, 16500, 16673, 16846, 17018, 17190, 17361, 17531, 17700, 17869, 18037,
+    18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001,
+    20160, 20318, 20475, 20632, 20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856,
+    22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028, 23170, 23312, 23453, 23593,
+    23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680, 24812, 24943, 25073, 25202,
+    25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199, 26320, 26439, 26557, 26674,
+    26791, 26906, 27020, 27133, 27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002,
+    28106, 28209, 28311, 28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178,
+    29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196,
+    30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853, 30920, 30986, 31050,
+    31114, 31177, 31238, 31298, 31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737,
+    31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099, 32138, 32177, 32214, 32251,
+    32286, 32319, 32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+    32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738, 32746, 32753,
+    32758, 32762, 32766, 32767, 32768
+};
+
+/**
+ * @brief 按 1/4 周期表求正弦
+ * @param phase 角度，一整圈 = 4 * FASTMATH_SIN_STEPS << 8 (低 8 位为插值权重)
+ * @return Q15 正弦值
+ */
+static int32_t SinPhase(uint32_t phase) {
+    uint32_t idx = (phase >> 8) & (FASTMATH_SIN_STEPS - 1);
+    uint32_t quadrant = (phase >> 16) & 3;
+    int32_t w = (int32_t)(phase & 0xFF);
+    int32_t a, b;
+
+    // 第 1/3 象限沿表正向读取，第 2/4 象限镜像读取
+    if (quadrant & 1) {
+        a = sin_table[FASTMATH_SIN_STEPS - idx];
+        b = sin_table[FASTMATH_SIN_STEPS - idx - 1];
+    } else {
+        a = sin_table[idx];
+        b = sin_table[idx + 1];
+    }
+    int32_t v = a + (((b - a) * w) >> 8);
+    return (quadrant & 2) ? -v : v;
+}
+
+/**
+ * @brief 弧度转换为 SinPhase 的相位 (每圈 2^18，按 32 位回绕)
+ * 超出 int32 范围 (约 5 万弧度) 时先对整圈取模，避免溢出；但相位精度在此之前已明显下降 (见 fastmath.h)
+ */
+static uint32_t RadToPhase(float rad) {
+    float p = rad * (float)((1u << 18) / (2.0 * M_PI));
+    if (p >= 2147483520.0f || p <= -2147483520.0f) {
+        p = fmodf(p, (float)(1u << 18));
+    }
+    return (uint32_t)(int32_t)p;
+}
+
+float FastMath_Sin(float rad) {
+    return SinPhase(RadToPhase(rad)) * (1.0f / 32768.0f);
+}
+
+float FastMath_Cos(float rad) {
+    return SinPhase(RadToPhase(rad) + (1u << 16)) * (1.0f / 32768.0f);
+}
+
+void FastMath_SinCos(float rad, float *s, float *c) {
+    uint32_t phase = RadToPhase(rad);
+    *s = SinPhase(phase) * (1.0f / 32768.0f);
+    *c = SinPhase(phase + (1u << 16)) * (1.0f / 32768.0f);
+}
+
+float FastMath_WrapAngle(float rad) {
+    if (rad >= (float)M_PI || rad < (float)-M_PI) {
+        rad -= (float)(2.0 * M_PI) * floorf((rad + (float)M_PI) * (float)(0.5 / M_PI));
+        // 浮点舍入可能恰好落在边界上
+        if (rad >= (float)M_PI) rad -= (float)(2.0 * M_PI);
+        else if (rad < (float)-M_PI) rad += (float)(2.0 * M_PI);
+    }
+    return rad;
+}
+
+int32_t FastMath_SinQ16(uint32_t angle) {
+    return SinPhase(angle << 2) * 2; // 2^16 刻度 -> 2^18 相位；Q15 -> Q16
+}
+
+int32_t FastMath_CosQ16(uint32_t angle) {
+    return SinPhase((angle << 2) + (1u << 16)) * 2;
+}
+
+float FastMath_Recip(float x) {
+    // 利用 IEEE754 指数取反得到约 12% 精度的初值，每次牛顿迭代 y = y * (2 - x * y) 使误差平方
+    uint32_t i;
+    float y;
+    memcpy(&i, &x, 4);
+    i = 0x7EF311C7u - i;
+    memcpy(&y, &i, 4);
+    y = y * (2.0f - x * y);
+    y = y * (2.0f - x * y);
+    return y;
+}
+
+float FastMath_Sqrt(float x) {
+    if (!(x > 0.0f)) return 0.0f;
+#if defined(__ARM_FP) && (__ARM_FP & 4)
+    float r;
+    __asm__("vsqrt.f32 %0, %1" : "=t"(r) : "t"(x));
+    return r;
+#else
+    // 倒数平方根初值 + 三次牛顿迭代，再乘以 x 得到平方根
+    uint32_t i;
+    float y;
+    memcpy(&i, &x, 4);
+    i = 0x5F375A86u - (i >> 1);
+    memcpy(&y, &i, 4);
+    float hx = 0.5f * x;
+    y = y * (1.5f - hx * y * y);
+    y = y * (1.5f - hx * y * y);
+    y = y * (1.5f - hx * y * y);
+    return x * y;
+#endif
+}
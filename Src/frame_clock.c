@@ -0,0 +1,118 @@
+//
+// 帧时钟：DWT 周期计数器计时，提供帧间隔 dt、帧率与帧时间直方图
+//
+
+#include "frame_clock.h"
+
+// 帧率平滑系数 (越小越平滑)
+#define FRAME_CLOCK_FPS_ALPHA 0.1f
+
+static uint32_t cycles_per_us = 1;
+static uint32_t last_cycles = 0;
+static uint32_t frac_cycles = 0;   // 不足 1us 的剩余周期，避免累计误差
+static uint32_t time_us = 0;
+static uint32_t frame_start_us = 0;
+static uint32_t frame_us = 0;
+static float frame_dt = 0.0f;
+static float avg_frame_us = 0.0f;
+static uint32_t histogram[FRAME_CLOCK_HIST_BINS];
+static bool started = false;
+
+/**
+ * @brief 初始化帧时钟
+ * 使用 Cortex-M4 的 DWT 周期计数器 (168MHz 下约 25 秒回绕一次，单帧差值不受影响)
+ */
+void FrameClock_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    cycles_per_us = SystemCoreClock / 1000000U;
+    if (cycles_per_us == 0) cycles_per_us = 1;
+
+    last_cycles = DWT->CYCCNT;
+    frac_cycles = 0;
+    time_us = 0;
+    frame_start_us = 0;
+    frame_us = 0;
+    frame_dt = 0.0f;
+    avg_frame_us = 0.0f;
+    started = false;
+    FrameClock_ResetStats();
+}
+
+/**
+ * @brief 将微秒时间推进到当前时刻
+ */
+static void FrameClock_Advance(void)
+{
+    uint32_t now = DWT->CYCCNT;
+    uint32_t cycles = (now - last_cycles) + frac_cycles;
+    last_cycles = now;
+
+    uint32_t us = cycles / cycles_per_us;
+    frac_cycles = cycles - us * cycles_per_us;
+    time_us += us;
+}
+
+float FrameClock_Tick(void)
+{
+    FrameClock_Advance();
+    uint32_t us = time_us - frame_start_us;
+    frame_start_us = time_us;
+
+    // 第一帧没有参考时间，按 60FPS 处理
+    if (!started) {
+        started = true;
+        us = 16667;
+    }
+
+    frame_us = us;
+    frame_dt = us * 1e-6f;
+    if (frame_dt > FRAME_CLOCK_MAX_DT) frame_dt = FRAME_CLOCK_MAX_DT;
+
+    if (avg_frame_us <= 0.0f) {
+        avg_frame_us = (float)us;
+    } else {
+        avg_frame_us += ((float)us - avg_frame_us) * FRAME_CLOCK_FPS_ALPHA;
+    }
+
+    uint32_t bin = us / FRAME_CLOCK_HIST_BIN_US;
+    if (bin >= FRAME_CLOCK_HIST_BINS) bin = FRAME_CLOCK_HIST_BINS - 1;
+    histogram[bin]++;
+
+    return frame_dt;
+}
+
+float FrameClock_GetDt(void)
+{
+    return frame_dt;
+}
+
+uint32_t FrameClock_GetFrameUs(void)
+{
+    return frame_us;
+}
+
+int FrameClock_GetFPS(void)
+{
+    if (avg_frame_us < 1.0f) return 0;
+    return (int)(1000000.0f / avg_frame_us + 0.5f);
+}
+
+uint32_t FrameClock_Micros(void)
+{
+    FrameClock_Advance();
+    return time_us;
+}
+
+const uint32_t* FrameClock_GetHistogram(void)
+{
+    return histogram;
+}
+
+void FrameClock_ResetStats(void)
+{
+    for (int i = 0; i < FRAME_CLOCK_HIST_BINS; i++) histogram[i] = 0;
+}
@@ -30,6 +30,8 @@
 #include "animation.h"
 #include "encoder.h"
 #include "menu.h"
+#include "mlcd_assets.h"
+#include "frame_clock.h"
 
 /* USER CODE END Includes */
 
@@ -40,6 +42,7 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define SPLASH_HOLD_MS 500 // 启动画面停留时间
 
 /* USER CODE END PD */
 
@@ -99,7 +102,10 @@ int main(void)
   MX_TIM5_Init();
   MX_TIM1_Init();
   /* USER CODE BEGIN 2 */
+  FrameClock_Init();
   MLCD_Init();
+  // 启动画面：压缩图片逐行解码直接送屏，不占用整帧解压缓冲
+  MLCD_StreamImage(0, 0, &image_splash, MLCD_COLOR_BLACK);
   Encoder_Init();
   
   // 动态构建菜单
@@ -108,6 +114,8 @@ int main(void)
   // Menu_Init 已经在 Setup_Menus 内部调用了 (或者我们应该保持分离)
   // 在 menu.c 的 Setup_Menus 实现中，最后调用了 Menu_Init(page_main)。
   // 所以这里 main.c 只需要调用 Setup_Menus 即可。
+
+  HAL_Delay(SPLASH_HOLD_MS);
   
   /* USER CODE END 2 */
 
@@ -6,20 +6,25 @@
 #include "mlcd.h"
 #include "encoder.h"
 #include "animation.h"
+#include "mlcd_assets.h"
+#include "mlcd_font_aa.h"
+#include "frame_clock.h"
+#include "fastmath.h"
 #include <stdlib.h> // malloc, free
 #include <string.h>
-#include <stdio.h>
 #include <math.h>
 
 // --- 系统状态 ---
 static MenuPage_t *current_page = NULL;
-SpringAnim_t cursor_anim; // 光标位置动画 (全局可见，供 main.c 修改参数)
-static SpringAnim_t scroll_anim; // 滚动条动画
+SpringId_t cursor_spring = SPRING_INVALID; // 光标位置动画 (全局可见，供 main.c 修改参数)
+static SpringId_t scroll_spring = SPRING_INVALID; // 滚动条动画
 static bool is_editing_value = false; // 标记是否处于数值编辑模式
 
 // 布局参数
 #define ITEM_HEIGHT      16   // 单行高度
 #define TITLE_HEIGHT     16   // 标题栏高度 (原20，改为16以容纳7行菜单)
+#define TITLE_FONT       mlcd_font_aa12
+#define TITLE_FONT_Y     1    // 大写字母 (第 3~11 行) 与两侧装饰方块垂直居中，下伸部分不超出标题栏
 #define SCREEN_VISIBLE_LINES ((MLCD_HEIGHT - TITLE_HEIGHT) / ITEM_HEIGHT)
 
 // --- Helper: 获取指定索引的 Item ---
@@ -87,7 +92,7 @@ MenuItem_t* Menu_AddAction(MenuPage_t *page, const char *label, MenuCallback_t c
     return item;
 }
 
-void Menu_SetItemIcon(MenuItem_t *item, const uint8_t *icon) {
+void Menu_SetItemIcon(MenuItem_t *item, const MLCD_Asset_t *icon) {
     if (item) item->icon = icon;
 }
 
@@ -175,12 +180,19 @@ bool setting_dark_mode = false;
 bool setting_show_scrollbar = true; // 滚动条显示开关
 static bool setting_menu_loop = false; // 新增：菜单循环开关
 static MenuPage_t *page_font;
+static MenuPage_t *page_transition;
+static bool setting_transition[TRANSITION_COUNT] = { [TRANSITION_DISSOLVE] = true }; // 过渡效果单选
 
 static int32_t setting_brightness = 50;
 static int32_t setting_contrast = 80;
 static int32_t setting_stiffness = 100;
 static int32_t setting_damping = 12;
 static int32_t setting_trans_ms = 500; // 过渡动画时间 (ms)
+static bool setting_perspective = true; // 3D 透视投影
+static bool setting_depth_cue = true;   // 3D 深度提示 (后方边抖动)
+static bool setting_hidden_lines = true; // 3D 消隐 (背面剔除)
+static bool setting_filled_3d = false;   // 3D 填充着色
+static bool setting_line_aa = false;     // 3D 抗锯齿线框 (演示中旋转编码器也可切换)
 
 // 全局菜单指针
 static MenuPage_t *page_main;
@@ -193,71 +205,24 @@ static MenuPage_t *page_anim; // 新增：动画菜单页
 // --- Animation Mode State ---
 static void (*current_animation_func)(void) = NULL;
 
-// --- Icons (32x32) ---
-// static const uint8_t icon_display[128] = {
-//     0x00,0x00,0x00,0x00, 0x00,0x01,0x80,0x00, 0x00,0x01,0x80,0x00, 0x00,0x01,0x80,0x00,
-//     0x00,0x01,0x80,0x00, 0x01,0x01,0x80,0x80, 0x00,0x81,0x81,0x00, 0x00,0x43,0xC2,0x00,
-//     0x00,0x27,0xE4,0x00, 0x00,0x1F,0xF8,0x00, 0x00,0x0F,0xF0,0x00, 0x00,0x0F,0xF0,0x00,
-//     0x00,0x0F,0xF0,0x00, 0x07,0xFF,0xFF,0xE0, 0x0F,0xFF,0xFF,0xF0, 0x1F,0xFF,0xFF,0xF8,
-//     0x1F,0xFF,0xFF,0xF8, 0x0F,0xFF,0xFF,0xF0, 0x07,0xFF,0xFF,0xE0, 0x00,0x0F,0xF0,0x00,
-//     0x00,0x0F,0xF0,0x00, 0x00,0x0F,0xF0,0x00, 0x00,0x1F,0xF8,0x00, 0x00,0x27,0xE4,0x00,
-//     0x00,0x43,0xC2,0x00, 0x00,0x81,0x81,0x00, 0x01,0x01,0x80,0x80, 0x00,0x01,0x80,0x00,
-//     0x00,0x01,0x80,0x00, 0x00,0x01,0x80,0x00, 0x00,0x01,0x80,0x00, 0x00,0x00,0x00,0x00
-// };
-
-static const uint8_t icon_damping[128] = {
-    0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00, 0x0F,0x00,0x00,0xF0,
-    0x1F,0x80,0x01,0xF8, 0x30,0xC0,0x03,0x0C, 0x20,0x60,0x06,0x04, 0x60,0x30,0x0C,0x06,
-    0x40,0x18,0x18,0x02, 0x40,0x0C,0x30,0x02, 0xC0,0x06,0x60,0x03, 0x80,0x03,0xC0,0x01,
-    0x80,0x01,0x80,0x01, 0x80,0x01,0x80,0x01, 0x80,0x03,0xC0,0x01, 0xC0,0x06,0x60,0x03,
-    0x40,0x0C,0x30,0x02, 0x40,0x18,0x18,0x02, 0x60,0x30,0x0C,0x06, 0x20,0x60,0x06,0x04,
-    0x30,0xC0,0x03,0x0C, 0x1F,0x80,0x01,0xF8, 0x0F,0x00,0x00,0xF0, 0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00
-};
-
-static const uint8_t icon_theme[128] = {
-    0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00, 0x00,0x07,0xE0,0x00, 0x00,0x1F,0xF8,0x00,
-    0x00,0x3F,0xFC,0x00, 0x00,0x7F,0xFE,0x00, 0x00,0xFF,0xFF,0x00, 0x01,0xFF,0xFF,0x80,
-    0x01,0xFF,0xFF,0x80, 0x03,0xFF,0xFF,0xC0, 0x03,0xF0,0x0F,0xC0, 0x07,0xE0,0x07,0xE0,
-    0x07,0xC0,0x03,0xE0, 0x0F,0x80,0x01,0xF0, 0x0F,0x00,0x00,0xF0, 0x0F,0x00,0x00,0xF0,
-    0x0F,0x00,0x00,0xF0, 0x0F,0x00,0x00,0xF0, 0x0F,0x80,0x01,0xF0, 0x07,0xC0,0x03,0xE0,
-    0x07,0xE0,0x07,0xE0, 0x03,0xF0,0x0F,0xC0, 0x03,0xFF,0xFF,0xC0, 0x01,0xFF,0xFF,0x80,
-    0x01,0xFF,0xFF,0x80, 0x00,0xFF,0xFF,0x00, 0x00,0x7F,0xFE,0x00, 0x00,0x3F,0xFC,0x00,
-    0x00,0x1F,0xF8,0x00, 0x00,0x07,0xE0,0x00, 0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00
-};
-
-// Icon Size: 32x32
-// Mode: vertical
-// Icon Size: 32x32
-// Mode: vertical
-static const uint8_t icon_display[128] = {
-    0xFF,0x07,0xE0,0xFF,0xFF,0x07,0xC0,0xFF,0xFF,0x03,0xC0,0xFF,0xFF,0xC3,0xC3,0xFF,
-    0xE7,0xE0,0x07,0xF7,0x03,0xE0,0x07,0xC0,0x03,0xF0,0x0F,0xC0,0x01,0xF8,0x1F,0x80,
-    0x01,0xFE,0x3F,0x80,0xF0,0x7F,0xFF,0x0F,0xF0,0x1F,0xF8,0x0F,0xF8,0x07,0xE0,0x0F,
-    0xF0,0x07,0xE0,0x0F,0xE0,0x03,0xC0,0x07,0xE1,0xC3,0xC3,0x87,0xE3,0xE3,0xC7,0xC7,
-    0xE3,0xE3,0xC7,0xC3,0xE1,0xC3,0xC3,0x87,0xE0,0x03,0xC0,0x07,0xF0,0x07,0xE0,0x0F,
-    0xF8,0x07,0xF0,0x0F,0xF0,0x1F,0xF8,0x0F,0xF0,0xFF,0xFF,0x0F,0x00,0xFC,0x3F,0x80,
-    0x01,0xF8,0x1F,0x80,0x03,0xF0,0x0F,0xC0,0x03,0xE0,0x07,0xC0,0xFF,0xE0,0x87,0xFF,
-    0xFF,0xC3,0xC7,0xFF,0xFF,0x03,0xC0,0xFF,0xFF,0x03,0xC0,0xFF,0xFF,0x07,0xF0,0xFF
-};
-
-
-
 // --- Callbacks ---
 static void Action_ToggleTheme(MenuItem_t *item) {
     // 切换变量已由 Menu 逻辑处理，这里可处理副作用
 }
 
 static void Action_ApplyCustomDamping(MenuItem_t *item) {
-    cursor_anim.stiffness = (float)setting_stiffness;
-    cursor_anim.damping = (float)setting_damping;
+    Animation_SpringPool_SetParams(cursor_spring, (float)setting_stiffness, (float)setting_damping);
 }
 
 static void Action_ApplyTransitionDuration(MenuItem_t *item) {
     Animation_SetTransitionDuration((float)setting_trans_ms / 1000.0f);
 }
 
+static void Action_SetTransition(MenuItem_t *item) {
+    // 单选项的 data 指向 setting_transition[] 中的元素，下标即过渡类型
+    Animation_SetTransitionType((TransitionType_t)((bool*)item->data - setting_transition));
+}
+
 static void Action_Save(MenuItem_t *item) {
     // Save config
 }
@@ -287,6 +252,29 @@ static void StartAnimSphere(MenuItem_t *item) {
     current_animation_func = Animation3D_Sphere_Run;
 }
 
+static void StartAnimParticles(MenuItem_t *item) {
+    Animation_ParticleDemo_Init();
+    current_animation_func = Animation_ParticleDemo_Run;
+}
+
+static void StartAnimBoxes(MenuItem_t *item) {
+    Animation_Init();
+    current_animation_func = Animation_Run;
+}
+
+static void Action_Apply3DView(MenuItem_t *item) {
+    Animation3D_SetCamera(setting_perspective ? ANIMATION3D_CAMERA_DISTANCE : 0.0f);
+    Animation3D_SetDepthCue(setting_depth_cue);
+    Animation3D_SetHiddenLineRemoval(setting_hidden_lines);
+    Animation3D_SetRenderMode(setting_filled_3d ? RENDER3D_FILLED : RENDER3D_WIREFRAME);
+    Animation3D_SetAntiAlias(setting_line_aa);
+}
+
+static void StartAnimSprite(MenuItem_t *item) {
+    Animation_SpriteDemo_Init();
+    current_animation_func = Animation_SpriteDemo_Run;
+}
+
 // --- Setup ---
 void Setup_Menus(void) {
     // 创建页面
@@ -296,6 +284,7 @@ void Setup_Menus(void) {
     page_display = Menu_CreatePage("Display");
     page_font = Menu_CreatePage("Font Select");
     page_damping = Menu_CreatePage("Anim Damping");
+    page_transition = Menu_CreatePage("Transition");
     page_info = Menu_CreatePage("System Info");
     page_demo = Menu_CreatePage("Demo Page");
     page_anim = Menu_CreatePage("Animations"); // 创建动画页
@@ -310,7 +299,7 @@ void Setup_Menus(void) {
     item = Menu_AddSubMenu(page_main, "Anims", page_anim); // 添加动画菜单入口
     
     item = Menu_AddSubMenu(page_main, "Display", page_display);
-    Menu_SetItemIcon(item, icon_display);
+    Menu_SetItemIcon(item, &icon_display);
 
     // 构建 Font Menu
     MenuItem_t *font_item;
@@ -333,10 +322,10 @@ void Setup_Menus(void) {
     Menu_AddSubMenu(page_display, "Fonts", page_font);
     
     item = Menu_AddSubMenu(page_main, "Anim Config", page_damping);
-    Menu_SetItemIcon(item, icon_damping);
+    Menu_SetItemIcon(item, &icon_damping);
     
     item = Menu_AddToggle(page_main, "Theme", &setting_dark_mode, Action_ToggleTheme);
-    Menu_SetItemIcon(item, icon_theme);
+    Menu_SetItemIcon(item, &icon_theme);
     
     item = Menu_AddToggle(page_main, "Sound", &setting_sound, NULL);
     item = Menu_AddToggle(page_main, "Vibrate", &setting_vibration, NULL);
@@ -351,6 +340,14 @@ void Setup_Menus(void) {
     Menu_AddAction(page_anim, "Cube", StartAnimCube, NULL);
     Menu_AddAction(page_anim, "Pyramid", StartAnimPyramid, NULL);
     Menu_AddAction(page_anim, "Sphere", StartAnimSphere, NULL);
+    Menu_AddAction(page_anim, "Spinner", StartAnimSprite, NULL);
+    Menu_AddAction(page_anim, "Particles", StartAnimParticles, NULL);
+    Menu_AddAction(page_anim, "Boxes", StartAnimBoxes, NULL);
+    Menu_AddToggle(page_anim, "Perspective", &setting_perspective, Action_Apply3DView);
+    Menu_AddToggle(page_anim, "Depth Cue", &setting_depth_cue, Action_Apply3DView);
+    Menu_AddToggle(page_anim, "Hide Lines", &setting_hidden_lines, Action_Apply3DView);
+    Menu_AddToggle(page_anim, "Filled", &setting_filled_3d, Action_Apply3DView);
+    Menu_AddToggle(page_anim, "Smooth Lines", &setting_line_aa, Action_Apply3DView);
     Menu_AddAction(page_anim, "Back", (MenuCallback_t)Menu_Back, NULL);
 
     // 构建 Display Menu
@@ -362,8 +359,20 @@ void Setup_Menus(void) {
     Menu_AddValue(page_damping, "Stiffness", &setting_stiffness, 50, 200, 10, Action_ApplyCustomDamping);
     Menu_AddValue(page_damping, "Damping", &setting_damping, 1, 30, 1, Action_ApplyCustomDamping);
     Menu_AddValue(page_damping, "Trans Time", &setting_trans_ms, 100, 2000, 50, Action_ApplyTransitionDuration);
+    Menu_AddSubMenu(page_damping, "Trans Style", page_transition);
     Menu_AddAction(page_damping, "Back", (MenuCallback_t)Menu_Back, NULL);
 
+    // 构建 Transition Menu (顺序与 TransitionType_t 一致)
+    static const char *const transition_names[TRANSITION_COUNT] = {
+        "Dissolve", "Slide", "Push", "Iris", "Blinds"
+    };
+    for (int i = 0; i < TRANSITION_COUNT; i++) {
+        item = Menu_AddItem(page_transition, transition_names[i], MENU_ITEM_RADIO);
+        item->data = &setting_transition[i];
+        item->callback = Action_SetTransition;
+    }
+    Menu_AddAction(page_transition, "Back", (MenuCallback_t)Menu_Back, NULL);
+
     // 构建 Info Menu
     Menu_AddAction(page_info, "Ver: 1.0.0", NULL, NULL);
     Menu_AddAction(page_info, "Build: Jan03", NULL, NULL);
@@ -394,8 +403,10 @@ void Menu_Init(MenuPage_t *root_page) {
     
     // 初始化动画系统
     // 刚度 100, 阻尼 12 -> 快速且有弹性的阻尼效果
-    Animation_Spring_Init(&cursor_anim, 0.0f, 100.0f, 12.0f);
-    Animation_Spring_Init(&scroll_anim, 0.0f, 60.0f, 10.0f);
+    if (cursor_spring == SPRING_INVALID) cursor_spring = Animation_SpringPool_Add(0.0f, 100.0f, 12.0f);
+    if (scroll_spring == SPRING_INVALID) scroll_spring = Animation_SpringPool_Add(0.0f, 60.0f, 10.0f);
+    Animation_SpringPool_Snap(cursor_spring, 0.0f);
+    Animation_SpringPool_Snap(scroll_spring, 0.0f);
     
     // 初始化过渡动画时长
     Animation_SetTransitionDuration((float)setting_trans_ms / 1000.0f);
@@ -477,9 +488,27 @@ static void HandleEnter(void) {
     }
 }
 
-static float entry_anim_progress = 0.0f;
+// 入场动画 (Staggered Slide In)：每项从上方 16px 处依次滑下
+// 总时长 (ENTRY_ANIM_MAX_ITEMS - 1) * ENTRY_ANIM_STAGGER + ENTRY_ANIM_ITEM_TIME = 0.8s
+#define ENTRY_ANIM_MAX_ITEMS 9      // 参与交错的项数，之后的项跟随最后一项
+#define ENTRY_ANIM_STAGGER   0.05f  // 每项延迟 (s)
+#define ENTRY_ANIM_ITEM_TIME 0.4f   // 单项时长 (s)
+#define ENTRY_ANIM_OFFSET    -16.0f
+static float entry_offset[ENTRY_ANIM_MAX_ITEMS];
 static bool is_entry_animating = false;
-#define ENTRY_ANIM_DURATION 0.8f
+
+static void Menu_EntryAnimDone(void *user) {
+    is_entry_animating = false;
+}
+
+/**
+ * @brief 获取第 i 项当前的入场偏移
+ */
+static int Menu_EntryOffset(int i) {
+    if (!is_entry_animating) return 0;
+    if (i >= ENTRY_ANIM_MAX_ITEMS) i = ENTRY_ANIM_MAX_ITEMS - 1;
+    return (int)entry_offset[i];
+}
 
 /**
  * @brief 强制进入页面
@@ -491,8 +520,17 @@ void Menu_Enter(MenuPage_t *page) {
     Animation_Transition_Start();
     
     // Start Entry Animation (Staggered Unfold)
-    is_entry_animating = true;
-    entry_anim_progress = 0.0f;
+    for (int i = 0; i < ENTRY_ANIM_MAX_ITEMS; i++) Animation_Tween_StopValue(&entry_offset[i]);
+    TweenId_t last = Animation_Tween_Stagger(entry_offset, ENTRY_ANIM_MAX_ITEMS, ENTRY_ANIM_OFFSET, 0.0f,
+                                             ENTRY_ANIM_ITEM_TIME, ENTRY_ANIM_STAGGER, EASE_OUT_CUBIC);
+    if (last == TWEEN_INVALID) {
+        // 补间池不足：跳过入场动画，否则完成回调永远不会到来
+        is_entry_animating = false;
+        for (int i = 0; i < ENTRY_ANIM_MAX_ITEMS; i++) entry_offset[i] = 0.0f;
+    } else {
+        is_entry_animating = true;
+        Animation_Tween_OnComplete(last, Menu_EntryAnimDone, NULL);
+    }
     
     current_page = page;
     
@@ -501,8 +539,8 @@ void Menu_Enter(MenuPage_t *page) {
     float target_y = current_page->selected_index * ITEM_HEIGHT;
     
     // 如果是刚进入，不想动画飞过来，可以直接 Reset
-    // Animation_Spring_Init(&cursor_anim, target_y, ...);
-    Animation_Spring_SetTarget(&cursor_anim, target_y);
+    // Animation_SpringPool_Snap(cursor_spring, target_y);
+    Animation_SpringPool_SetTarget(cursor_spring, target_y);
     
     // 简单的滚动跟随策略
     // 如果选中项在可视区域外，需要调整 scroll
@@ -521,35 +559,113 @@ void Menu_Back(void) {
     }
     
     if (current_page && current_page->parent) {
-        // Start transition
-        Animation_Transition_Start();
+        // Start transition (返回方向)
+        Animation_Transition_StartDir(TRANSITION_DIR_BACKWARD);
         
         current_page = current_page->parent;
         
         // 更新动画目标回父页面的选中位置
         float target_y = current_page->selected_index * ITEM_HEIGHT;
-        Animation_Spring_SetTarget(&cursor_anim, target_y);
+        Animation_SpringPool_SetTarget(cursor_spring, target_y);
     }
 }
 
 /**
  * @brief 绘制当前菜单
  */
-static float label_pop_anim = 0.0f; // 标签弹出动画 (0.0 ~ 1.0)
+static float label_pop_anim = 1.0f; // 标签弹出动画 (0.0 ~ 1.0)
+#define LABEL_POP_TIME 0.16f        // 弹出时长 (s)
 static int last_selected_index = -1;
 
+// --- 选中项跑马灯 (Marquee) ---
+// 超出行宽的标签在选中时预渲染为离屏位图，每帧仅做移位 Blit，不重新光栅化字形
+#define MARQUEE_MAX_CHARS 40
+#define MARQUEE_STRIDE    ((MARQUEE_MAX_CHARS * MLCD_FONT_ADVANCE + 7) / 8)
+#define MARQUEE_SPEED     24.0f // 滚动速度 (px/s)
+#define MARQUEE_PAUSE     1.0f  // 两端停顿时间 (s)
+
+typedef enum {
+    MARQUEE_PAUSE_START,
+    MARQUEE_SCROLL_FWD,
+    MARQUEE_PAUSE_END,
+    MARQUEE_SCROLL_BACK
+} MarqueePhase_t;
+
+static struct {
+    const MenuItem_t *item;  // 当前预渲染的菜单项 (NULL 表示无)
+    int box_w;               // 可视宽度
+    int text_w;              // 标签总宽度
+    float offset;            // 当前滚动偏移 (px)
+    float timer;             // 停顿计时
+    MarqueePhase_t phase;
+    uint8_t bitmap[MLCD_FONT_HEIGHT][MARQUEE_STRIDE];
+} marquee;
+
+/**
+ * @brief 推进跑马灯状态 (两端停顿，往返滚动)
+ */
+static void Menu_Marquee_Update(float dt) {
+    if (!marquee.item) return;
+    
+    float max_offset = (float)(marquee.text_w - marquee.box_w);
+    if (max_offset <= 0) return;
+    
+    switch (marquee.phase) {
+        case MARQUEE_PAUSE_START:
+        case MARQUEE_PAUSE_END:
+            marquee.timer += dt;
+            if (marquee.timer >= MARQUEE_PAUSE) {
+                marquee.timer = 0.0f;
+                marquee.phase = (marquee.phase == MARQUEE_PAUSE_START) ? MARQUEE_SCROLL_FWD : MARQUEE_SCROLL_BACK;
+            }
+            break;
+        case MARQUEE_SCROLL_FWD:
+            marquee.offset += MARQUEE_SPEED * dt;
+            if (marquee.offset >= max_offset) {
+                marquee.offset = max_offset;
+                marquee.phase = MARQUEE_PAUSE_END;
+            }
+            break;
+        case MARQUEE_SCROLL_BACK:
+            marquee.offset -= MARQUEE_SPEED * dt;
+            if (marquee.offset <= 0.0f) {
+                marquee.offset = 0.0f;
+                marquee.phase = MARQUEE_PAUSE_START;
+            }
+            break;
+    }
+}
+
+/**
+ * @brief 以跑马灯方式绘制选中项标签
+ */
+static void Menu_DrawMarquee(const MenuItem_t *item, int x, int y, int w, uint8_t color) {
+    // 选中项或可用宽度变化时重新预渲染 (仅此一次光栅化)
+    if (marquee.item != item || marquee.box_w != w) {
+        int len = MLCD_MeasureText(item->label) / MLCD_FONT_ADVANCE;
+        if (len > MARQUEE_MAX_CHARS) len = MARQUEE_MAX_CHARS;
+        
+        marquee.text_w = MLCD_RenderText(&marquee.bitmap[0][0], MARQUEE_STRIDE, item->label, len);
+        marquee.item = item;
+        marquee.box_w = w;
+        marquee.offset = 0.0f;
+        marquee.timer = 0.0f;
+        marquee.phase = MARQUEE_PAUSE_START;
+    }
+    
+    MLCD_BlitMask(x, y, w, MLCD_FONT_HEIGHT, &marquee.bitmap[0][0], MARQUEE_STRIDE,
+                  (int)(marquee.offset + 0.5f), color);
+}
+
 static void Menu_Render(void) {
     if (!current_page) return;
     
     // 如果选中项改变，重置弹出动画
     if (current_page->selected_index != last_selected_index) {
-        label_pop_anim = 0.0f;
+        Animation_Tween_StopValue(&label_pop_anim);
+        Animation_Tween_Start(&label_pop_anim, 0.0f, 1.0f, LABEL_POP_TIME, 0.0f, EASE_LINEAR);
         last_selected_index = current_page->selected_index;
-    }
-    // 动画更新
-    if (label_pop_anim < 1.0f) {
-        label_pop_anim += 0.1f; // 速度可调
-        if (label_pop_anim > 1.0f) label_pop_anim = 1.0f;
+        marquee.item = NULL;
     }
     
     MLCD_ClearBuffer();
@@ -570,8 +686,8 @@ static void Menu_Render(void) {
         
         // 目标滚动位置
         float target_scroll = current_page->selected_index * item_width;
-        Animation_Spring_SetTarget(&scroll_anim, target_scroll);
-        float current_scroll = scroll_anim.position;
+        Animation_SpringPool_SetTarget(scroll_spring, target_scroll);
+        float current_scroll = Animation_SpringPool_GetPosition(scroll_spring);
         
         // 遍历所有项目
         MenuItem_t *curr_item = current_page->head;
@@ -593,7 +709,7 @@ static void Menu_Render(void) {
                 // 归一化距离 (0~1, 0为中心)
                 float t = dist / max_dist;
                 // Cosine 插值或其他曲线: 1.0 -> 0.0
-                float boost = 0.5f * (1.0f + cosf(t * 3.14159f)); // 0~1
+                float boost = 0.5f * (1.0f + FastMath_Cos(t * (float)M_PI)); // 0~1 (查表)
                 // 缩放范围: 0.8 ~ 1.2
                 scale = 0.8f + (0.4f * boost);
             }
@@ -605,9 +721,10 @@ static void Menu_Render(void) {
             int draw_x = item_center_x - scaled_w / 2;
             int draw_y = center_y - scaled_h / 2;
             
-            // 1. 绘制图标 (缩放)
+            // 1. 绘制图标 (使用资源编译器预缩放的版本，直接 Blit)
             if (curr_item->icon) {
-                MLCD_DrawBitmapScaled(draw_x, draw_y, icon_w, icon_h, curr_item->icon, scale, MLCD_COLOR_BLACK);
+                const MLCD_Bitmap_t *bmp = MLCD_AssetGetSize(curr_item->icon, scaled_w);
+                MLCD_DrawImage(item_center_x - bmp->w / 2, center_y - bmp->h / 2, bmp, MLCD_COLOR_BLACK);
             } else {
                 MLCD_DrawRect(draw_x, draw_y, scaled_w, scaled_h, MLCD_COLOR_BLACK);
                 MLCD_DrawChar(draw_x + scaled_w/2 - 3, draw_y + scaled_h/2 - 4, '?', MLCD_COLOR_BLACK);
@@ -619,12 +736,10 @@ static void Menu_Render(void) {
                 // 简单的从下往上浮现 + 透明度(模拟) -> 只能做位移
                 float anim_offset = (1.0f - label_pop_anim) * 10.0f;
                 
-                const char *label = curr_item->label;
-                int text_w = strlen(label) * 6;
-                int text_x = center_x - text_w / 2; // 固定在屏幕中心
                 int text_y = center_y + (int)(icon_h * 1.2f / 2) + 8 + (int)anim_offset; // 基于最大图标高度
                 
-                MLCD_DrawString(text_x, text_y, label, MLCD_COLOR_BLACK);
+                // 固定在屏幕中心，超宽时截断
+                MLCD_DrawStringAligned(0, text_y, MLCD_WIDTH, curr_item->label, MLCD_ALIGN_CENTER, MLCD_COLOR_BLACK);
             }
         }
         
@@ -633,7 +748,7 @@ static void Menu_Render(void) {
         int max_icon_w = (int)(icon_w * 1.2f);
         int max_icon_h = (int)(icon_h * 1.2f);
         
-        float speed = fabsf(scroll_anim.velocity);
+        float speed = fabsf(Animation_SpringPool_GetVelocity(scroll_spring));
         float expansion = speed * 0.04f; 
         if (expansion > 10.0f) expansion = 10.0f;
         
@@ -683,12 +798,12 @@ static void Menu_Render(void) {
         
         // 2. 计算滚动偏移 (Edge Scroll 策略)
         // 只有当光标超出可视区域时才推动滚动条，避免居中策略导致的频繁抖动
-        float cursor_target_y = cursor_anim.target;
+        float cursor_target_y = Animation_SpringPool_GetTarget(cursor_spring);
         // 绘制光标时仍需要使用瞬时位置
-        float cursor_y = cursor_anim.position;
+        float cursor_y = Animation_SpringPool_GetPosition(cursor_spring);
         
         // 当前滚动条的目标位置
-        float current_scroll_target = scroll_anim.target;
+        float current_scroll_target = Animation_SpringPool_GetTarget(scroll_spring);
         
         // 计算可视窗口的绝对坐标范围
         float view_top = current_scroll_target;
@@ -716,8 +831,8 @@ static void Menu_Render(void) {
         if (next_scroll_target < 0) next_scroll_target = 0;
         if (next_scroll_target > max_scroll) next_scroll_target = max_scroll;
         
-        Animation_Spring_SetTarget(&scroll_anim, next_scroll_target);
-        float current_scroll = scroll_anim.position;
+        Animation_SpringPool_SetTarget(scroll_spring, next_scroll_target);
+        float current_scroll = Animation_SpringPool_GetPosition(scroll_spring);
         
         int start_y = TITLE_HEIGHT;
         
@@ -730,21 +845,7 @@ static void Menu_Render(void) {
             int item_y_raw = (int)((i * ITEM_HEIGHT) - current_scroll + 0.5f) + start_y;
 
             // 应用入场动画 (Staggered Slide In)
-            if (is_entry_animating) {
-                float item_delay = i * 0.05f; // 每个项目延迟 0.05s
-                float item_duration = 0.4f;
-                float anim_time = entry_anim_progress - item_delay;
-                
-                if (anim_time < 0) anim_time = 0;
-                float p = anim_time / item_duration;
-                if (p > 1.0f) p = 1.0f;
-                
-                // Ease Out Cubic
-                p = 1.0f - (1.0f - p) * (1.0f - p) * (1.0f - p);
-                
-                // 从上方 16px 处滑下
-                item_y_raw += (int)((1.0f - p) * -16.0f);
-            }
+            item_y_raw += Menu_EntryOffset(i);
             
             int item_y = item_y_raw;
             
@@ -758,13 +859,15 @@ static void Menu_Render(void) {
             int text_y = item_y + 4; // 垂直居中微调
             if (text_y >= start_y - 6 && text_y < MLCD_HEIGHT) { // 稍微放宽绘制边界
                 
-                MLCD_DrawString(6, text_y, curr_item->label, color);
+                // Label 可用宽度 (右侧状态控件占用的部分在下面扣除)
+                int label_w = MLCD_WIDTH - 6 - 6;
                 
                 // 绘制右侧状态
                 char buf[32];
                 switch (curr_item->type) {
                     case MENU_ITEM_SUBMENU:
                         MLCD_DrawString(MLCD_WIDTH - 12, text_y, ">", color);
+                        label_w = MLCD_WIDTH - 12 - 2 - 6;
                         break;
                     case MENU_ITEM_TOGGLE:
                         if (curr_item->data) {
@@ -786,6 +889,7 @@ static void Menu_Render(void) {
                                     MLCD_DrawLine(box_x+2, box_y+k, box_x+box_size-2, box_y+k, color);
                                 }
                             }
+                            label_w = box_x - 2 - 6;
                         }
                         break;
                     case MENU_ITEM_VALUE:
@@ -795,15 +899,19 @@ static void Menu_Render(void) {
                             // 如果是当前选中项且处于编辑模式，显示为 < val >
                             bool is_editing_this = (is_editing_value && i == current_page->selected_index);
                             
+                            int len;
                             if (is_editing_this) {
-                                sprintf(buf, "< %ld >", val);
+                                // "< val >"
+                                buf[0] = '<';
+                                buf[1] = ' ';
+                                len = 2 + MLCD_FormatNumber(buf + 2, sizeof(buf) - 2, val, 0, 0, 0, " >");
                             } else {
-                                sprintf(buf, "%ld", val);
+                                len = MLCD_FormatInt(buf, sizeof(buf), val);
                             }
                             
-                            // 右对齐
-                            int w = strlen(buf) * 6;
-                            MLCD_DrawString(MLCD_WIDTH - w - 4, text_y, buf, color);
+                            // 右对齐 (距右边缘 4px)
+                            MLCD_DrawStringAlignedN(0, text_y, MLCD_WIDTH - 4, buf, len, MLCD_ALIGN_RIGHT, color);
+                            label_w = MLCD_WIDTH - 4 - MLCD_MeasureTextN(buf, len) - 4 - 6;
                         }
                         break;
                     case MENU_ITEM_RADIO:
@@ -826,10 +934,18 @@ static void Menu_Render(void) {
                                     MLCD_DrawLine(box_x+2, box_y+k, box_x+box_size-2, box_y+k, color);
                                 }
                             }
+                            label_w = box_x - 2 - 6;
                         }
                         break;
                     default: break;
                 }
+                
+                // 绘制 Label: 选中项超宽时滚动显示，其余超宽时以省略号截断
+                if (i == current_page->selected_index && MLCD_MeasureText(curr_item->label) > label_w) {
+                    Menu_DrawMarquee(curr_item, 6, text_y, label_w, color);
+                } else {
+                    MLCD_DrawStringAligned(6, text_y, label_w, curr_item->label, MLCD_ALIGN_LEFT, color);
+                }
             }
         }
         
@@ -839,17 +955,7 @@ static void Menu_Render(void) {
         int draw_cursor_y = (int)(cursor_y - current_scroll + 0.5f) + start_y;
 
         // 如果正在播放入场动画，光标也应该跟随当前选中项一起移动
-        if (is_entry_animating) {
-             int i = current_page->selected_index;
-             float item_delay = i * 0.05f; 
-             float item_duration = 0.4f;
-             float anim_time = entry_anim_progress - item_delay;
-             if (anim_time < 0) anim_time = 0;
-             float p = anim_time / item_duration;
-             if (p > 1.0f) p = 1.0f;
-             p = 1.0f - (1.0f - p) * (1.0f - p) * (1.0f - p);
-             draw_cursor_y += (int)((1.0f - p) * -16.0f);
-        }
+        draw_cursor_y += Menu_EntryOffset(current_page->selected_index);
         
         // 对光标区域进行反色处理 (X: 2 ~ WIDTH-3, Height: ITEM_HEIGHT)
         // 限制在内容区域内
@@ -902,9 +1008,8 @@ static void Menu_Render(void) {
 
     // 1. 绘制标题栏
     // 标题文字 (黑色) + 装饰
-    // 格式: ■ Title ■
-    int title_len = strlen(current_page->title);
-    int full_len = title_len + 4; // 增加装饰字符长度
+    // 格式: ■ Title ■ (标题使用抗锯齿字体，灰边按屏幕坐标抖动)
+    int title_w = MLCD_MeasureTextFont(&TITLE_FONT, current_page->title);
     
     // 如果开启 FPS 显示，标题栏整体左移，留出右上角空间
     int fps_width = 0;
@@ -912,10 +1017,15 @@ static void Menu_Render(void) {
         fps_width = 36; // 预留 "FPS:XX" 的宽度 (约 6 chars * 6 px)
     }
     
+    // 标题过长时截断 (两侧装饰共占 4 个字符宽度)
+    int title_max_w = MLCD_WIDTH - 4 * MLCD_FONT_ADVANCE - fps_width;
+    if (title_w > title_max_w) title_w = title_max_w;
+    int full_w = title_w + 4 * MLCD_FONT_ADVANCE; // 增加装饰字符长度
+    
     // 计算居中位置 (在剩余空间内居中，或者简单的整体偏移)
     // 这里采用整体偏移策略：如果有 FPS，中心点向左移
     int center_offset = fps_width / 2;
-    int title_x = (MLCD_WIDTH - (full_len * 6)) / 2 - center_offset;
+    int title_x = (MLCD_WIDTH - full_w) / 2 - center_offset;
     
     if (title_x < 0) title_x = 0;
     
@@ -924,10 +1034,10 @@ static void Menu_Render(void) {
     MLCD_DrawRect(title_x+1, 7, 2, 2, MLCD_COLOR_WHITE); // 镂空一点
     
     // 绘制标题
-    MLCD_DrawString(title_x + 12, 4, current_page->title, MLCD_COLOR_BLACK);
+    MLCD_DrawStringFont(title_x + 12, TITLE_FONT_Y, title_w, &TITLE_FONT, current_page->title, MLCD_COLOR_BLACK);
     
     // 绘制右装饰
-    int right_x = title_x + 12 + title_len * 6 + 6;
+    int right_x = title_x + 12 + title_w + 6;
     MLCD_DrawRect(right_x, 6, 4, 4, MLCD_COLOR_BLACK);
     MLCD_DrawRect(right_x+1, 7, 2, 2, MLCD_COLOR_WHITE);
 
@@ -939,23 +1049,11 @@ static void Menu_Render(void) {
     // 5. 绘制 FPS (最顶层，不被反色影响? 或者被反色影响均可)
     // 这里放在反色之后，意味着 FPS 文字也会随深色模式变色 (如果它是黑色的，反色后变白，刚好)
     if (setting_show_fps) {
-        static uint32_t last_tick = 0;
-        static int frame_count = 0;
-        static int fps = 0;
-        
-        frame_count++;
-        uint32_t current_tick = HAL_GetTick();
-        if (current_tick - last_tick >= 1000) {
-            fps = frame_count;
-            frame_count = 0;
-            last_tick = current_tick;
-        }
-        
         char fps_str[16];
-        sprintf(fps_str, "%d", fps); // 只显示数字，节省空间
+        int fps_len = MLCD_FormatInt(fps_str, sizeof(fps_str), FrameClock_GetFPS()); // 只显示数字，节省空间
         // 右上角显示
-        int fps_x = MLCD_WIDTH - (strlen(fps_str) * 6) - 2;
-        MLCD_DrawString(fps_x, 4, fps_str, setting_dark_mode ? MLCD_COLOR_WHITE : MLCD_COLOR_BLACK);
+        MLCD_DrawStringAlignedN(0, 4, MLCD_WIDTH - 2, fps_str, fps_len, MLCD_ALIGN_RIGHT,
+                                setting_dark_mode ? MLCD_COLOR_WHITE : MLCD_COLOR_BLACK);
         // 画个小框？
         // MLCD_DrawRect(fps_x - 2, 4, 20, 10, ...);
     }
@@ -972,6 +1070,9 @@ static void Menu_Render(void) {
 void Menu_Loop(void) {
     if (!current_page) return;
     
+    // 0. 帧时钟：所有动画都按本帧真实经过的时间推进
+    float dt = FrameClock_Tick();
+
     // 1. 获取输入
     Encoder_Scan();
     int32_t diff = Encoder_GetDiff();
@@ -982,10 +1083,27 @@ void Menu_Loop(void) {
         if (key == KEY_EVENT_CLICK || key == KEY_EVENT_LONG_PRESS || key == KEY_EVENT_DOUBLE_CLICK) {
             // Exit animation mode on any key press
             current_animation_func = NULL;
-            // Force redraw menu
-            Animation_Transition_Start();
+            // Force redraw menu (返回菜单，按返回方向过渡)
+            Animation_Transition_StartDir(TRANSITION_DIR_BACKWARD);
             return;
         } else {
+            // 3D 演示中旋转编码器切换普通/抗锯齿线框，便于直接对比
+            if (diff != 0 && (current_animation_func == Animation3D_Cube_Run ||
+                              current_animation_func == Animation3D_Pyramid_Run ||
+                              current_animation_func == Animation3D_Sphere_Run)) {
+                setting_line_aa = !setting_line_aa;
+                Action_Apply3DView(NULL);
+            }
+            // 粒子演示中旋转编码器调整粒子数
+            if (diff != 0 && current_animation_func == Animation_ParticleDemo_Run) {
+                Animation_ParticleDemo_Adjust(diff > 0 ? 1 : -1);
+            }
+            // 方块演示中旋转编码器调整方块数
+            if (diff != 0 && current_animation_func == Animation_Run) {
+                int count = Animation_Boxes_GetCount();
+                count = (count < BOX_DEMO_STEP && diff > 0) ? BOX_DEMO_STEP : count + (diff > 0 ? BOX_DEMO_STEP : -BOX_DEMO_STEP);
+                Animation_Boxes_SetCount(count);
+            }
             // Run animation frame
             current_animation_func();
             return; // Skip menu rendering
@@ -1019,10 +1137,10 @@ void Menu_Loop(void) {
              
              // 更新动画目标
              if (current_page->layout == MENU_LAYOUT_CAROUSEL) {
-                 // 轮播模式：更新 scroll_anim (在 Render 中根据 selected_index 计算)
+                 // 轮播模式：更新 scroll_spring (在 Render 中根据 selected_index 计算)
              } else {
                  // 列表模式：更新光标位置
-                 Animation_Spring_SetTarget(&cursor_anim, current_page->selected_index * ITEM_HEIGHT);
+                 Animation_SpringPool_SetTarget(cursor_spring, current_page->selected_index * ITEM_HEIGHT);
              }
         }
     }
@@ -1036,20 +1154,11 @@ void Menu_Loop(void) {
         Menu_Back();
     }
     
-    // 4. 更新动画 (假设 60FPS -> dt=0.016)
-    // 实际应计算 delta tick
-    Animation_Spring_Update(&cursor_anim, 0.016f);
-    Animation_Spring_Update(&scroll_anim, 0.016f);
-    Animation_Transition_Update(0.016f);
-
-    // 更新入场动画
-    if (is_entry_animating) {
-        entry_anim_progress += 0.016f;
-        if (entry_anim_progress >= ENTRY_ANIM_DURATION) {
-            entry_anim_progress = ENTRY_ANIM_DURATION;
-            is_entry_animating = false;
-        }
-    }
+    // 4. 更新动画 (dt 来自帧时钟，动画速度与帧率无关)
+    Animation_SpringPool_Update(dt); // 一次推进所有弹簧 (解析解)
+    Animation_Transition_Update(dt);
+    Menu_Marquee_Update(dt);
+    Animation_Tween_Update(dt); // 入场动画、标签弹出等补间
     
     // 5. 绘制
     Menu_Render();
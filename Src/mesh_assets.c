@@ -0,0 +1,224 @@
+//
+// Generated by tools/meshgen.py - do not edit.
+// Source: assets/meshes/
+//
+
+#include "mesh_assets.h"
+
+#include <stddef.h>
+
+// cube.obj: 8 vertices, 12 edges, 6 faces, radius 1
+static const int8_t mesh_cube_vertices[24] = {
+    -127, -127, -127, 127, -127, -127, 127, 127, -127, -127, 127, -127,
+    -127, -127, 127, 127, -127, 127, 127, 127, 127, -127, 127, 127,
+};
+
+static const int8_t mesh_cube_normals[18] = {
+    0, 0, -127, 0, 0, 127, 0, -127, 0, 0, 127, 0,
+    -127, 0, 0, 127, 0, 0,
+};
+
+static const uint8_t mesh_cube_faces[24] = {
+    3, 2, 1, 0, 4, 5, 6, 7, 0, 1, 5, 4, 7, 6, 2, 3,
+    4, 7, 3, 0, 1, 2, 6, 5,
+};
+
+static const uint8_t mesh_cube_edges[48] = {
+    3, 2, 0, 3, 2, 1, 0, 5, 1, 0, 0, 2, 0, 3, 0, 4,
+    4, 5, 1, 2, 5, 6, 1, 5, 6, 7, 1, 3, 7, 4, 1, 4,
+    1, 5, 2, 5, 4, 0, 2, 4, 6, 2, 3, 5, 3, 7, 3, 4,
+};
+
+const Mesh_t mesh_cube = {
+    .vertices = mesh_cube_vertices,
+    .normals = mesh_cube_normals,
+    .edges = mesh_cube_edges,
+    .faces = mesh_cube_faces,
+    .vertex_count = 8,
+    .edge_count = 12,
+    .face_count = 6,
+    .flags = 0,
+};
+
+// pyramid.obj: 4 vertices, 6 edges, 4 faces, radius 1
+static const int8_t mesh_pyramid_vertices[12] = {
+    0, -127, 0, -127, 127, -90, 127, 127, -90, 0, 127, 90,
+};
+
+static const int8_t mesh_pyramid_normals[12] = {
+    0, -42, -120, 102, -25, 72, -102, -25, 72, 0, 127, 0,
+};
+
+static const uint8_t mesh_pyramid_faces[16] = {
+    0, 1, 2, 255, 0, 2, 3, 255, 0, 3, 1, 255, 3, 2, 1, 255,
+};
+
+static const uint8_t mesh_pyramid_edges[24] = {
+    0, 1, 0, 2, 1, 2, 0, 3, 2, 0, 0, 1, 2, 3, 1, 3,
+    3, 0, 1, 2, 3, 1, 2, 3,
+};
+
+const Mesh_t mesh_pyramid = {
+    .vertices = mesh_pyramid_vertices,
+    .normals = mesh_pyramid_normals,
+    .edges = mesh_pyramid_edges,
+    .faces = mesh_pyramid_faces,
+    .vertex_count = 4,
+    .edge_count = 6,
+    .face_count = 4,
+    .flags = 0,
+};
+
+// sphere.obj: 98 vertices, 204 edges, 108 faces, radius 1
+static const int8_t mesh_sphere_vertices[294] = {
+    0, -127, 0, 43, -119, 0, 38, -119, 22, 22, -119, 38,
+    0, -119, 43, -22, -119, 38, -38, -119, 22, -43, -119, 0,
+    -38, -119, -22, -22, -119, -38, 0, -119, -43, 22, -119, -38,
+    38, -119, -22, 82, -97, 0, 71, -97, 41, 41, -97, 71,
+    0, -97, 82, -41, -97, 71, -71, -97, 41, -82, -97, 0,
+    -71, -97, -41, -41, -97, -71, 0, -97, -82, 41, -97, -71,
+    71, -97, -41, 110, -64, 0, 95, -64, 55, 55, -64, 95,
+    0, -64, 110, -55, -64, 95, -95, -64, 55, -110, -64, 0,
+    -95, -64, -55, -55, -64, -95, 0, -64, -110, 55, -64, -95,
+    95, -64, -55, 125, -22, 0, 108, -22, 63, 63, -22, 108,
+    0, -22, 125, -63, -22, 108, -108, -22, 63, -125, -22, 0,
+    -108, -22, -63, -63, -22, -108, 0, -22, -125, 63, -22, -108,
+    108, -22, -63, 125, 22, 0, 108, 22, 63, 63, 22, 108,
+    0, 22, 125, -63, 22, 108, -108, 22, 63, -125, 22, 0,
+    -108, 22, -63, -63, 22, -108, 0, 22, -125, 63, 22, -108,
+    108, 22, -63, 110, 64, 0, 95, 64, 55, 55, 64, 95,
+    0, 64, 110, -55, 64, 95, -95, 64, 55, -110, 64, 0,
+    -95, 64, -55, -55, 64, -95, 0, 64, -110, 55, 64, -95,
+    95, 64, -55, 82, 97, 0, 71, 97, 41, 41, 97, 71,
+    0, 97, 82, -41, 97, 71, -71, 97, 41, -82, 97, 0,
+    -71, 97, -41, -41, 97, -71, 0, 97, -82, 41, 97, -71,
+    71, 97, -41, 43, 119, 0, 38, 119, 22, 22, 119, 38,
+    0, 119, 43, -22, 119, 38, -38, 119, 22, -43, 119, 0,
+    -38, 119, -22, -22, 119, -38, 0, 119, -43, 22, 119, -38,
+    38, 119, -22, 0, 127, 0,
+};
+
+static const int8_t mesh_sphere_normals[324] = {
+    22, -125, 6, 22, 125, 6, 16, -125, 16, 16, 125, 16,
+    6, -125, 22, 6, 125, 22, -6, -125, 22, -6, 125, 22,
+    -16, -125, 16, -16, 125, 16, -22, -125, 6, -22, 125, 6,
+    -22, -125, -6, -22, 125, -6, -16, -125, -16, -16, 125, -16,
+    -6, -125, -22, -6, 125, -22, 6, -125, -22, 6, 125, -22,
+    16, -125, -16, 16, 125, -16, 22, -125, -6, 22, 125, -6,
+    63, -109, 17, 46, -109, 46, 17, -109, 63, -17, -109, 63,
+    -46, -109, 46, -63, -109, 17, -63, -109, -17, -46, -109, -46,
+    -17, -109, -63, 17, -109, -63, 46, -109, -46, 63, -109, -17,
+    95, -80, 26, 70, -80, 70, 26, -80, 95, -26, -80, 95,
+    -70, -80, 70, -95, -80, 26, -95, -80, -26, -70, -80, -70,
+    -26, -80, -95, 26, -80, -95, 70, -80, -70, 95, -80, -26,
+    116, -42, 31, 85, -42, 85, 31, -42, 116, -31, -42, 116,
+    -85, -42, 85, -116, -42, 31, -116, -42, -31, -85, -42, -85,
+    -31, -42, -116, 31, -42, -116, 85, -42, -85, 116, -42, -31,
+    123, 0, 33, 90, 0, 90, 33, 0, 123, -33, 0, 123,
+    -90, 0, 90, -123, 0, 33, -123, 0, -33, -90, 0, -90,
+    -33, 0, -123, 33, 0, -123, 90, 0, -90, 123, 0, -33,
+    116, 42, 31, 85, 42, 85, 31, 42, 116, -31, 42, 116,
+    -85, 42, 85, -116, 42, 31, -116, 42, -31, -85, 42, -85,
+    -31, 42, -116, 31, 42, -116, 85, 42, -85, 116, 42, -31,
+    95, 80, 26, 70, 80, 70, 26, 80, 95, -26, 80, 95,
+    -70, 80, 70, -95, 80, 26, -95, 80, -26, -70, 80, -70,
+    -26, 80, -95, 26, 80, -95, 70, 80, -70, 95, 80, -26,
+    63, 109, 17, 46, 109, 46, 17, 109, 63, -17, 109, 63,
+    -46, 109, 46, -63, 109, 17, -63, 109, -17, -46, 109, -46,
+    -17, 109, -63, 17, 109, -63, 46, 109, -46, 63, 109, -17,
+};
+
+static const uint8_t mesh_sphere_faces[432] = {
+    0, 1, 2, 255, 86, 85, 97, 255, 0, 2, 3, 255, 87, 86, 97, 255,
+    0, 3, 4, 255, 88, 87, 97, 255, 0, 4, 5, 255, 89, 88, 97, 255,
+    0, 5, 6, 255, 90, 89, 97, 255, 0, 6, 7, 255, 91, 90, 97, 255,
+    0, 7, 8, 255, 92, 91, 97, 255, 0, 8, 9, 255, 93, 92, 97, 255,
+    0, 9, 10, 255, 94, 93, 97, 255, 0, 10, 11, 255, 95, 94, 97, 255,
+    0, 11, 12, 255, 96, 95, 97, 255, 0, 12, 1, 255, 85, 96, 97, 255,
+    13, 14, 2, 1, 14, 15, 3, 2, 15, 16, 4, 3, 16, 17, 5, 4,
+    17, 18, 6, 5, 18, 19, 7, 6, 19, 20, 8, 7, 20, 21, 9, 8,
+    21, 22, 10, 9, 22, 23, 11, 10, 23, 24, 12, 11, 24, 13, 1, 12,
+    25, 26, 14, 13, 26, 27, 15, 14, 27, 28, 16, 15, 28, 29, 17, 16,
+    29, 30, 18, 17, 30, 31, 19, 18, 31, 32, 20, 19, 32, 33, 21, 20,
+    33, 34, 22, 21, 34, 35, 23, 22, 35, 36, 24, 23, 36, 25, 13, 24,
+    37, 38, 26, 25, 38, 39, 27, 26, 39, 40, 28, 27, 40, 41, 29, 28,
+    41, 42, 30, 29, 42, 43, 31, 30, 43, 44, 32, 31, 44, 45, 33, 32,
+    45, 46, 34, 33, 46, 47, 35, 34, 47, 48, 36, 35, 48, 37, 25, 36,
+    49, 50, 38, 37, 50, 51, 39, 38, 51, 52, 40, 39, 52, 53, 41, 40,
+    53, 54, 42, 41, 54, 55, 43, 42, 55, 56, 44, 43, 56, 57, 45, 44,
+    57, 58, 46, 45, 58, 59, 47, 46, 59, 60, 48, 47, 60, 49, 37, 48,
+    61, 62, 50, 49, 62, 63, 51, 50, 63, 64, 52, 51, 64, 65, 53, 52,
+    65, 66, 54, 53, 66, 67, 55, 54, 67, 68, 56, 55, 68, 69, 57, 56,
+    69, 70, 58, 57, 70, 71, 59, 58, 71, 72, 60, 59, 72, 61, 49, 60,
+    73, 74, 62, 61, 74, 75, 63, 62, 75, 76, 64, 63, 76, 77, 65, 64,
+    77, 78, 66, 65, 78, 79, 67, 66, 79, 80, 68, 67, 80, 81, 69, 68,
+    81, 82, 70, 69, 82, 83, 71, 70, 83, 84, 72, 71, 84, 73, 61, 72,
+    85, 86, 74, 73, 86, 87, 75, 74, 87, 88, 76, 75, 88, 89, 77, 76,
+    89, 90, 78, 77, 90, 91, 79, 78, 91, 92, 80, 79, 92, 93, 81, 80,
+    93, 94, 82, 81, 94, 95, 83, 82, 95, 96, 84, 83, 96, 85, 73, 84,
+};
+
+static const uint8_t mesh_sphere_edges[816] = {
+    0, 1, 0, 22, 1, 2, 0, 24, 2, 0, 0, 2, 86, 85, 1, 96,
+    85, 97, 1, 23, 97, 86, 1, 3, 2, 3, 2, 25, 3, 0, 2, 4,
+    87, 86, 3, 97, 97, 87, 3, 5, 3, 4, 4, 26, 4, 0, 4, 6,
+    88, 87, 5, 98, 97, 88, 5, 7, 4, 5, 6, 27, 5, 0, 6, 8,
+    89, 88, 7, 99, 97, 89, 7, 9, 5, 6, 8, 28, 6, 0, 8, 10,
+    90, 89, 9, 100, 97, 90, 9, 11, 6, 7, 10, 29, 7, 0, 10, 12,
+    91, 90, 11, 101, 97, 91, 11, 13, 7, 8, 12, 30, 8, 0, 12, 14,
+    92, 91, 13, 102, 97, 92, 13, 15, 8, 9, 14, 31, 9, 0, 14, 16,
+    93, 92, 15, 103, 97, 93, 15, 17, 9, 10, 16, 32, 10, 0, 16, 18,
+    94, 93, 17, 104, 97, 94, 17, 19, 10, 11, 18, 33, 11, 0, 18, 20,
+    95, 94, 19, 105, 97, 95, 19, 21, 11, 12, 20, 34, 12, 0, 20, 22,
+    96, 95, 21, 106, 97, 96, 21, 23, 12, 1, 22, 35, 85, 96, 23, 107,
+    13, 14, 24, 36, 14, 2, 24, 25, 1, 13, 24, 35, 14, 15, 25, 37,
+    15, 3, 25, 26, 15, 16, 26, 38, 16, 4, 26, 27, 16, 17, 27, 39,
+    17, 5, 27, 28, 17, 18, 28, 40, 18, 6, 28, 29, 18, 19, 29, 41,
+    19, 7, 29, 30, 19, 20, 30, 42, 20, 8, 30, 31, 20, 21, 31, 43,
+    21, 9, 31, 32, 21, 22, 32, 44, 22, 10, 32, 33, 22, 23, 33, 45,
+    23, 11, 33, 34, 23, 24, 34, 46, 24, 12, 34, 35, 24, 13, 35, 47,
+    25, 26, 36, 48, 26, 14, 36, 37, 13, 25, 36, 47, 26, 27, 37, 49,
+    27, 15, 37, 38, 27, 28, 38, 50, 28, 16, 38, 39, 28, 29, 39, 51,
+    29, 17, 39, 40, 29, 30, 40, 52, 30, 18, 40, 41, 30, 31, 41, 53,
+    31, 19, 41, 42, 31, 32, 42, 54, 32, 20, 42, 43, 32, 33, 43, 55,
+    33, 21, 43, 44, 33, 34, 44, 56, 34, 22, 44, 45, 34, 35, 45, 57,
+    35, 23, 45, 46, 35, 36, 46, 58, 36, 24, 46, 47, 36, 25, 47, 59,
+    37, 38, 48, 60, 38, 26, 48, 49, 25, 37, 48, 59, 38, 39, 49, 61,
+    39, 27, 49, 50, 39, 40, 50, 62, 40, 28, 50, 51, 40, 41, 51, 63,
+    41, 29, 51, 52, 41, 42, 52, 64, 42, 30, 52, 53, 42, 43, 53, 65,
+    43, 31, 53, 54, 43, 44, 54, 66, 44, 32, 54, 55, 44, 45, 55, 67,
+    45, 33, 55, 56, 45, 46, 56, 68, 46, 34, 56, 57, 46, 47, 57, 69,
+    47, 35, 57, 58, 47, 48, 58, 70, 48, 36, 58, 59, 48, 37, 59, 71,
+    49, 50, 60, 72, 50, 38, 60, 61, 37, 49, 60, 71, 50, 51, 61, 73,
+    51, 39, 61, 62, 51, 52, 62, 74, 52, 40, 62, 63, 52, 53, 63, 75,
+    53, 41, 63, 64, 53, 54, 64, 76, 54, 42, 64, 65, 54, 55, 65, 77,
+    55, 43, 65, 66, 55, 56, 66, 78, 56, 44, 66, 67, 56, 57, 67, 79,
+    57, 45, 67, 68, 57, 58, 68, 80, 58, 46, 68, 69, 58, 59, 69, 81,
+    59, 47, 69, 70, 59, 60, 70, 82, 60, 48, 70, 71, 60, 49, 71, 83,
+    61, 62, 72, 84, 62, 50, 72, 73, 49, 61, 72, 83, 62, 63, 73, 85,
+    63, 51, 73, 74, 63, 64, 74, 86, 64, 52, 74, 75, 64, 65, 75, 87,
+    65, 53, 75, 76, 65, 66, 76, 88, 66, 54, 76, 77, 66, 67, 77, 89,
+    67, 55, 77, 78, 67, 68, 78, 90, 68, 56, 78, 79, 68, 69, 79, 91,
+    69, 57, 79, 80, 69, 70, 80, 92, 70, 58, 80, 81, 70, 71, 81, 93,
+    71, 59, 81, 82, 71, 72, 82, 94, 72, 60, 82, 83, 72, 61, 83, 95,
+    73, 74, 84, 96, 74, 62, 84, 85, 61, 73, 84, 95, 74, 75, 85, 97,
+    75, 63, 85, 86, 75, 76, 86, 98, 76, 64, 86, 87, 76, 77, 87, 99,
+    77, 65, 87, 88, 77, 78, 88, 100, 78, 66, 88, 89, 78, 79, 89, 101,
+    79, 67, 89, 90, 79, 80, 90, 102, 80, 68, 90, 91, 80, 81, 91, 103,
+    81, 69, 91, 92, 81, 82, 92, 104, 82, 70, 92, 93, 82, 83, 93, 105,
+    83, 71, 93, 94, 83, 84, 94, 106, 84, 72, 94, 95, 84, 73, 95, 107,
+    86, 74, 96, 97, 73, 85, 96, 107, 87, 75, 97, 98, 88, 76, 98, 99,
+    89, 77, 99, 100, 90, 78, 100, 101, 91, 79, 101, 102, 92, 80, 102, 103,
+    93, 81, 103, 104, 94, 82, 104, 105, 95, 83, 105, 106, 96, 84, 106, 107,
+};
+
+const Mesh_t mesh_sphere = {
+    .vertices = mesh_sphere_vertices,
+    .normals = mesh_sphere_normals,
+    .edges = mesh_sphere_edges,
+    .faces = mesh_sphere_faces,
+    .vertex_count = 98,
+    .edge_count = 204,
+    .face_count = 108,
+    .flags = 0,
+};
@@ -7,11 +7,20 @@
 #include "tim.h"
 #include <stdlib.h> // for abs()
 #include <string.h> // for memcpy
+#include <stdbool.h>
 
 // 显存缓冲区 (1 bit per pixel)
 // 128 * 128 / 8 = 2048 bytes
 static uint8_t mlcd_buffer[MLCD_HEIGHT][MLCD_WIDTH / 8];
 
+#if MLCD_PARTIAL_REFRESH
+// 上一次发送到屏幕的画面 (局部刷新比较用)
+static uint8_t mlcd_sent[MLCD_HEIGHT][MLCD_WIDTH / 8];
+static uint16_t refresh_count = 0;
+#endif
+static bool refresh_force_full = true; // 上电后屏幕内容未知，首帧全量发送
+static MLCD_RowFilter_t row_filter = NULL;
+
 // Sharp Memory LCD 命令定义 (配合 LSB First SPI)
 // Command Byte Structure: M0 M1 M2 D4 D5 D6 D7 D8
 // M0: Mode (1=Update, 0=No Update)
@@ -74,6 +83,8 @@ void MLCD_Clear(void)
     MLCD_SoftDelay(); // thSCS Hold time
     HAL_GPIO_WritePin(CS_GPIO_Port, CS_Pin, GPIO_PIN_RESET);
     MLCD_SoftDelay(); // twSCSL Interval
+
+    MLCD_ForceFullRefresh();
 }
 
 /**
@@ -432,35 +443,39 @@ static MLCD_Font_t current_font = MLCD_FONT_NORMAL;
  * @brief 设置当前字体
  */
 void MLCD_SetFont(MLCD_Font_t font) {
+    if (font != current_font) {
+        // 字体切换后宽度可能不同，缓存失效
+        MLCD_InvalidateTextCache();
+    }
     current_font = font;
 }
 
 /**
- * @brief 绘制字符 (5x7)
+ * @brief 获取当前字体下字符的字模 (不可显示字符返回 NULL)
  */
-void MLCD_DrawChar(uint8_t x, uint8_t y, char c, uint8_t color)
+static const uint8_t* MLCD_GetGlyph(char c)
 {
-    if (c < ' ' || c > '~') return;
-    
-    // 字符数据
-    const uint8_t *char_data;
-    
+    if (c < ' ' || c > '~') return NULL;
+
     switch (current_font) {
         case MLCD_FONT_BOLD:
-            char_data = font5x7_bold[c - ' '];
-            break;
+            return font5x7_bold[c - ' '];
         case MLCD_FONT_YAHEI:
-            char_data = font5x7_yahei[c - ' '];
-            break;
+            return font5x7_yahei[c - ' '];
         case MLCD_FONT_NORMAL:
         default:
-            char_data = font5x7[c - ' '];
-            break;
+            return font5x7[c - ' '];
     }
-    
-    for (int col = 0; col < 5; col++) {
+}
+
+/**
+ * @brief 绘制字模 (有符号坐标，允许部分移出屏幕左/上边缘)
+ */
+static void MLCD_DrawGlyph(int x, int y, const uint8_t *char_data, uint8_t color)
+{
+    for (int col = 0; col < MLCD_FONT_WIDTH; col++) {
         uint8_t line = char_data[col];
-        for (int row = 0; row < 7; row++) {
+        for (int row = 0; row < MLCD_FONT_HEIGHT; row++) {
             if (line & (1 << row)) {
                 MLCD_SetPixel(x + col, y + row, color);
             }
@@ -468,6 +483,17 @@ void MLCD_DrawChar(uint8_t x, uint8_t y, char c, uint8_t color)
     }
 }
 
+/**
+ * @brief 绘制字符 (5x7)
+ */
+void MLCD_DrawChar(uint8_t x, uint8_t y, char c, uint8_t color)
+{
+    const uint8_t *char_data = MLCD_GetGlyph(c);
+    if (!char_data) return;
+
+    MLCD_DrawGlyph(x, y, char_data, color);
+}
+
 /**
  * @brief 绘制字符串
  */
@@ -475,11 +501,344 @@ void MLCD_DrawString(uint8_t x, uint8_t y, const char *str, uint8_t color)
 {
     while (*str) {
         MLCD_DrawChar(x, y, *str, color);
-        x += 6; // 5 + 1 spacing
+        x += MLCD_FONT_ADVANCE; // 5 + 1 spacing
         str++;
     }
 }
 
+// ----------------------------------------------------------------------------
+// 文本度量与排版
+// ----------------------------------------------------------------------------
+
+// 宽度缓存 (直接映射，按字符串指针索引)
+// 菜单标签、标题都是常量字符串，指针不变则内容不变，命中后无需 strlen
+#define TEXT_CACHE_SIZE 16
+
+typedef struct {
+    const char *str;
+    int width;
+} TextWidthCache_t;
+
+static TextWidthCache_t text_cache[TEXT_CACHE_SIZE];
+
+// 省略号: 三个间隔 1px 的点，占一个字符宽度
+#define ELLIPSIS_WIDTH MLCD_FONT_ADVANCE
+
+void MLCD_InvalidateTextCache(void)
+{
+    memset(text_cache, 0, sizeof(text_cache));
+}
+
+int MLCD_MeasureTextN(const char *str, int len)
+{
+    if (!str || len <= 0) return 0;
+    return len * MLCD_FONT_ADVANCE;
+}
+
+/**
+ * @brief 测量字符串宽度 (带缓存)
+ * @note 缓存以指针为键，str 必须指向内容不变的字符串；动态缓冲区请使用 MLCD_MeasureTextN
+ */
+int MLCD_MeasureText(const char *str)
+{
+    if (!str) return 0;
+
+    TextWidthCache_t *entry = &text_cache[((uintptr_t)str >> 2) % TEXT_CACHE_SIZE];
+    if (entry->str != str) {
+        entry->str = str;
+        entry->width = MLCD_MeasureTextN(str, (int)strlen(str));
+    }
+    return entry->width;
+}
+
+/**
+ * @brief 绘制省略号 (底部三个点)
+ */
+static void MLCD_DrawEllipsis(int x, int y, uint8_t color)
+{
+    for (int i = 0; i < 3; i++) {
+        MLCD_SetPixel(x + i * 2, y + MLCD_FONT_HEIGHT - 1, color);
+    }
+}
+
+void MLCD_DrawStringAlignedN(int x, int y, int w, const char *str, int len, MLCD_Align_t align, uint8_t color)
+{
+    if (!str || w <= 0) return;
+
+    int text_w = MLCD_MeasureTextN(str, len);
+    int draw_len = len;
+    bool truncated = false;
+
+    // 超宽：截断并预留省略号位置
+    if (text_w > w) {
+        draw_len = (w - ELLIPSIS_WIDTH) / MLCD_FONT_ADVANCE;
+        if (draw_len < 0) draw_len = 0;
+        text_w = draw_len * MLCD_FONT_ADVANCE + ELLIPSIS_WIDTH;
+        truncated = true;
+    }
+
+    int cx = x;
+    if (align == MLCD_ALIGN_CENTER) {
+        cx = x + (w - text_w) / 2;
+    } else if (align == MLCD_ALIGN_RIGHT) {
+        cx = x + w - text_w;
+    }
+
+    for (int i = 0; i < draw_len; i++) {
+        const uint8_t *char_data = MLCD_GetGlyph(str[i]);
+        if (char_data) MLCD_DrawGlyph(cx, y, char_data, color);
+        cx += MLCD_FONT_ADVANCE;
+    }
+
+    if (truncated) {
+        MLCD_DrawEllipsis(cx, y, color);
+    }
+}
+
+/**
+ * @brief 对齐绘制常量字符串 (宽度走缓存)
+ */
+void MLCD_DrawStringAligned(int x, int y, int w, const char *str, MLCD_Align_t align, uint8_t color)
+{
+    if (!str) return;
+    int len = MLCD_MeasureText(str) / MLCD_FONT_ADVANCE;
+    MLCD_DrawStringAlignedN(x, y, w, str, len, align, color);
+}
+
+// ----------------------------------------------------------------------------
+// 数值格式化
+// ----------------------------------------------------------------------------
+
+/**
+ * @brief 格式化定点数
+ * @param buf 输出缓冲区
+ * @param size 缓冲区大小 (含 '\0')
+ * @param val 原始整数值，实际显示 val / 10^decimals
+ * @param decimals 小数位数 (0 表示整数)
+ * @param width 最小宽度 (符号 + 数字 + 小数点，不含单位)
+ * @param flags MLCD_FMT_SIGN / MLCD_FMT_ZERO 组合
+ * @param unit 单位后缀 (可为 NULL)
+ * @return 写入的字符数 (不含 '\0')
+ */
+int MLCD_FormatNumber(char *buf, int size, int32_t val, int decimals, int width, uint8_t flags, const char *unit)
+{
+    if (!buf || size <= 0) return 0;
+    if (decimals < 0) decimals = 0;
+    if (decimals > 10) decimals = 10; // int32 最多 10 位
+
+    // 取绝对值 (用无符号处理 INT32_MIN)
+    uint32_t mag = (val < 0) ? (0u - (uint32_t)val) : (uint32_t)val;
+    char sign = 0;
+    if (val < 0) sign = '-';
+    else if (flags & MLCD_FMT_SIGN) sign = '+';
+
+    // 逆序生成数字，小数部分至少补齐到 decimals 位，整数部分至少 1 位
+    char digits[16];
+    int n = 0;
+    do {
+        if (n == decimals && decimals > 0) digits[n++] = '.';
+        digits[n++] = (char)('0' + mag % 10);
+        mag /= 10;
+    } while (mag || n <= decimals);
+
+    int unit_len = unit ? (int)strlen(unit) : 0;
+    int body_len = n + (sign ? 1 : 0);
+    int pad = (width > body_len) ? width - body_len : 0;
+    int total = body_len + pad + unit_len;
+
+    if (total >= size) {
+        buf[0] = '\0';
+        return 0;
+    }
+
+    char *p = buf;
+    if (flags & MLCD_FMT_ZERO) {
+        // 补零在符号之后: -0042
+        if (sign) *p++ = sign;
+        while (pad--) *p++ = '0';
+    } else {
+        while (pad--) *p++ = ' ';
+        if (sign) *p++ = sign;
+    }
+    while (n > 0) *p++ = digits[--n];
+    for (int i = 0; i < unit_len; i++) *p++ = unit[i];
+    *p = '\0';
+
+    return total;
+}
+
+int MLCD_FormatInt(char *buf, int size, int32_t val)
+{
+    return MLCD_FormatNumber(buf, size, val, 0, 0, 0, NULL);
+}
+
+/**
+ * @brief 预渲染字符串到离屏位图 (显存位序，1 = 笔画)
+ * @param dst 目标缓冲区，大小至少 MLCD_FONT_HEIGHT * stride
+ * @param stride 每行字节数
+ * @return 渲染宽度 (像素)
+ */
+int MLCD_RenderText(uint8_t *dst, int stride, const char *str, int len)
+{
+    if (!dst || !str || stride <= 0) return 0;
+
+    memset(dst, 0, MLCD_FONT_HEIGHT * stride);
+
+    int max_w = stride * 8;
+    int x = 0;
+    for (int i = 0; i < len && x < max_w; i++, x += MLCD_FONT_ADVANCE) {
+        const uint8_t *char_data = MLCD_GetGlyph(str[i]);
+        if (!char_data) continue;
+
+        for (int col = 0; col < MLCD_FONT_WIDTH && x + col < max_w; col++) {
+            uint8_t line = char_data[col];
+            int px = x + col;
+            for (int row = 0; row < MLCD_FONT_HEIGHT; row++) {
+                if (line & (1 << row)) {
+                    dst[row * stride + (px >> 3)] |= (uint8_t)(1 << (px & 7));
+                }
+            }
+        }
+    }
+
+    return (x < max_w) ? x : max_w;
+}
+
+/**
+ * @brief 获取紧凑字体中的字形 (不在范围内返回 NULL)
+ */
+static const MLCD_Glyph_t* MLCD_FontGlyph(const MLCD_FontDesc_t *font, char c)
+{
+    uint8_t code = (uint8_t)c;
+    if (code < font->first || code > font->last) return NULL;
+    return &font->glyphs[code - font->first];
+}
+
+// 按掩码写入显存字节 (color 非 0 置位，否则清零)
+static inline void MLCD_WriteMask(uint8_t *p, uint8_t mask, uint8_t color)
+{
+    if (color) *p |= mask;
+    else *p &= (uint8_t)~mask;
+}
+
+/**
+ * @brief 由 mlcd_bayer4x4 导出字体阈值：thr[r] 的第 i 个半字节为 (bayer[r][i] * 15) >> 4
+ */
+static void MLCD_FontThresholds(uint16_t thr[4])
+{
+    for (int r = 0; r < 4; r++) {
+        thr[r] = 0;
+        for (int i = 0; i < 4; i++) thr[r] |= (uint16_t)(((mlcd_bayer4x4[r][i] * 15) >> 4) << (i * 4));
+    }
+}
+
+/**
+ * @brief 绘制一个紧凑字形
+ * 覆盖率 level (0~15) 与 mlcd_bayer4x4 比较：level / 15 > bayer / 16 时点亮，即 level > (bayer * 15) >> 4 (15 恒亮，0 恒灭)。
+ * 阈值按屏幕坐标取，文字移动时抖动图案固定在屏幕上，相邻字形的灰边也连成同一图案。
+ * 每次取 4 个源字节 (8 个像素)，奇偶像素各占一个 8 位通道，一次减法比较 4 个像素，再拼成一个字节掩码写入。
+ * @param thr 每行 (y % 4) 4 个阈值的半字节排列 (MLCD_FontThresholds)
+ */
+static void MLCD_DrawFontGlyph(int x, int y, const MLCD_Glyph_t *g, const uint8_t *src,
+                               const uint16_t thr[4], uint8_t color)
+{
+    int stride = (g->w + 1) >> 1;
+    int gx0 = (x < 0) ? -x : 0;
+    int gx1 = (x + g->w > MLCD_WIDTH) ? MLCD_WIDTH - x : g->w;
+    if (gx0 >= gx1) return;
+    int start = gx0 & ~1;        // 源数据按字节 (两个像素) 对齐
+    int rot = ((x + start) & 3) * 4; // 每次前进 8 像素，行内的 Bayer 相位不变
+
+    for (int gy = 0; gy < g->h; gy++, src += stride) {
+        int sy = y + gy;
+        if ((unsigned)sy >= MLCD_HEIGHT) continue;
+
+        // 本行 8 个像素的阈值：按相位循环移位后重复两次，再拆成奇偶两组 (+1 用于下面的比较)
+        uint32_t t = thr[sy & 3];
+        t = ((t >> rot) | (t << (16 - rot))) & 0xFFFF;
+        t |= t << 16;
+        uint32_t thr_even = (t & 0x0F0F0F0F) + 0x01010101;
+        uint32_t thr_odd = ((t >> 4) & 0x0F0F0F0F) + 0x01010101;
+        uint8_t *row = mlcd_buffer[sy];
+
+        for (int gx = start; gx < gx1; gx += 8) {
+            const uint8_t *p = src + (gx >> 1);
+            int n = (gx1 - gx + 1) >> 1;
+            if (n > 4) n = 4;
+            uint32_t v = p[0];
+            switch (n) {
+            case 4: v |= (uint32_t)p[3] << 24; // fall through
+            case 3: v |= (uint32_t)p[2] << 16; // fall through
+            case 2: v |= (uint32_t)p[1] << 8;  // fall through
+            default: break;
+            }
+
+            // (level | 16) - (thr + 1) 落在 1~30，第 4 位即 level > thr，通道之间不会借位
+            uint32_t even = (((v & 0x0F0F0F0F) | 0x10101010) - thr_even) & 0x10101010;
+            uint32_t odd = ((((v >> 4) & 0x0F0F0F0F) | 0x10101010) - thr_odd) & 0x10101010;
+            uint32_t m = (even >> 4) | (odd >> 3); // 像素 2i / 2i+1 位于第 8i / 8i+1 位
+            m |= m >> 6;
+            uint32_t mask = (m | (m >> 12)) & 0xFF;
+            if (gx1 - gx < 8) mask &= (1u << (gx1 - gx)) - 1;
+
+            int sx = x + gx;
+            if (gx < gx0) { mask >>= 1; sx++; } // 左侧裁剪在奇数列：第一个像素在屏幕外
+            if (!mask) continue;
+            uint32_t span = mask << (sx & 7);
+            MLCD_WriteMask(&row[sx >> 3], (uint8_t)span, color);
+            if (span >> 8) MLCD_WriteMask(&row[(sx >> 3) + 1], (uint8_t)(span >> 8), color);
+        }
+    }
+}
+
+/**
+ * @brief 使用紧凑字形字体绘制字符串
+ * @param w 最大宽度 (像素)，超宽时截断到能放下 "..." 的位置
+ * @return 绘制宽度 (像素)
+ */
+int MLCD_DrawStringFont(int x, int y, int w, const MLCD_FontDesc_t *font, const char *str, uint8_t color)
+{
+    if (!font || !str || w <= 0) return 0;
+
+    int limit = w;
+    if (MLCD_MeasureTextFont(font, str) > w) {
+        limit = w - MLCD_MeasureTextFont(font, "...");
+        if (limit < 0) limit = 0;
+    }
+
+    uint16_t thr[4];
+    MLCD_FontThresholds(thr);
+
+    int pen = x;
+    for (; *str; str++) {
+        const MLCD_Glyph_t *g = MLCD_FontGlyph(font, *str);
+        if (!g) continue;
+        if (pen + g->advance - x > limit) {
+            // 截断：剩余部分替换为省略号
+            if (limit < w) pen += MLCD_DrawStringFont(pen, y, w - (pen - x), font, "...", color);
+            break;
+        }
+
+        if (g->w) {
+            MLCD_DrawFontGlyph(pen + g->x_ofs, y + g->y_ofs, g, font->bitmap + g->offset, thr, color);
+        }
+        pen += g->advance;
+    }
+    return pen - x;
+}
+
+int MLCD_MeasureTextFont(const MLCD_FontDesc_t *font, const char *str)
+{
+    if (!font || !str) return 0;
+
+    int w = 0;
+    for (; *str; str++) {
+        const MLCD_Glyph_t *g = MLCD_FontGlyph(font, *str);
+        if (g) w += g->advance;
+    }
+    return w;
+}
+
 /**
  * @brief 绘制粗体字符 (5x7)
  */
@@ -535,6 +894,192 @@ void MLCD_DrawBitmap(int x, int y, int w, int h, const uint8_t *bitmap, uint8_t
     }
 }
 
+// ----------------------------------------------------------------------------
+// 游程编码 (MLCD_ENC_RLE) 流式解码
+// 像素按行优先排成一条流，游程颜色从 0 开始交替；
+// 每个游程长度由若干半字节 (高位在前) 累加，值为 15 时继续读取下一个半字节
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    const uint8_t *src;
+    uint32_t nibble;    // 下一个半字节序号
+    int remaining;      // 当前游程剩余像素
+    uint8_t color;      // 当前游程颜色
+} RleDecoder_t;
+
+static void Rle_Init(RleDecoder_t *dec, const uint8_t *src)
+{
+    dec->src = src;
+    dec->nibble = 0;
+    dec->remaining = 0;
+    dec->color = 1; // 第一次取游程时翻转为 0
+}
+
+static int Rle_ReadLength(RleDecoder_t *dec)
+{
+    int len = 0;
+    uint8_t n;
+    do {
+        uint8_t byte = dec->src[dec->nibble >> 1];
+        n = (dec->nibble & 1) ? (byte & 0x0F) : (byte >> 4);
+        dec->nibble++;
+        len += n;
+    } while (n == 15);
+    return len;
+}
+
+/**
+ * @brief 将 [x, x+n) 范围内的位置 1 (显存位序)
+ */
+static inline void SetBitRange(uint8_t *row, int x, int n)
+{
+    while (n > 0) {
+        int sh = x & 7;
+        int k = 8 - sh;
+        if (k > n) k = n;
+        row[x >> 3] |= (uint8_t)(((1u << k) - 1) << sh);
+        x += k;
+        n -= k;
+    }
+}
+
+/**
+ * @brief 将 [x, x+n) 范围内的位取反
+ */
+static inline void XorBitRange(uint8_t *row, int x, int n)
+{
+    while (n > 0) {
+        int sh = x & 7;
+        int k = 8 - sh;
+        if (k > n) k = n;
+        row[x >> 3] ^= (uint8_t)(((1u << k) - 1) << sh);
+        x += k;
+        n -= k;
+    }
+}
+
+/**
+ * @brief 解码一行到 row (stride 字节)
+ */
+static void Rle_ReadRow(RleDecoder_t *dec, uint8_t *row, int w, int stride)
+{
+    memset(row, 0, stride);
+
+    int x = 0;
+    while (x < w) {
+        if (dec->remaining == 0) {
+            dec->color ^= 1;
+            dec->remaining = Rle_ReadLength(dec);
+            continue;
+        }
+        int n = dec->remaining;
+        if (n > w - x) n = w - x;
+        if (dec->color) SetBitRange(row, x, n);
+        x += n;
+        dec->remaining -= n;
+    }
+}
+
+/**
+ * @brief 绘制图片资源 (显存位序，直接 Blit)
+ */
+void MLCD_DrawImage(int x, int y, const MLCD_Bitmap_t *bmp, uint8_t color) {
+    if (!bmp || !bmp->data) return;
+
+    if (bmp->encoding == MLCD_ENC_RAW) {
+        MLCD_BlitMask(x, y, bmp->w, bmp->h, bmp->data, bmp->stride, 0, color);
+        return;
+    }
+
+    // 压缩数据：逐行解码到固定的小缓冲区后立即 Blit，不需要整图解压空间
+    if (bmp->stride > MLCD_WIDTH / 8) return;
+    uint8_t row[MLCD_WIDTH / 8];
+    RleDecoder_t dec;
+    Rle_Init(&dec, bmp->data);
+
+    for (int r = 0; r < bmp->h; r++) {
+        // 屏幕外的行也要解码以推进数据流，但超出底部后可直接结束
+        if (y + r >= MLCD_HEIGHT) break;
+        Rle_ReadRow(&dec, row, bmp->w, bmp->stride);
+        if (y + r >= 0) {
+            MLCD_BlitMask(x, y + r, bmp->w, 1, row, bmp->stride, 0, color);
+        }
+    }
+}
+
+/**
+ * @brief 带透明掩码绘制图片
+ * 先以反色填充掩码区域，再以 color 绘制笔画，两步都走流式 Blit
+ */
+void MLCD_DrawImageMasked(int x, int y, const MLCD_Bitmap_t *img, const MLCD_Bitmap_t *mask, uint8_t color) {
+    if (mask) MLCD_DrawImage(x, y, mask, !color);
+    MLCD_DrawImage(x, y, img, color);
+}
+
+/**
+ * @brief 将图片解码到缓冲区 (覆盖或异或)
+ */
+void MLCD_UnpackImage(const MLCD_Bitmap_t *bmp, uint8_t *dst, uint8_t mode) {
+    if (!bmp || !bmp->data || !dst) return;
+    int size = bmp->stride * bmp->h;
+
+    if (bmp->encoding == MLCD_ENC_RAW) {
+        if (mode == MLCD_UNPACK_XOR) {
+            for (int i = 0; i < size; i++) dst[i] ^= bmp->data[i];
+        } else {
+            memcpy(dst, bmp->data, size);
+        }
+        return;
+    }
+
+    if (mode != MLCD_UNPACK_XOR) memset(dst, 0, size);
+
+    // 直接按游程置位/翻转，不经过行缓冲
+    RleDecoder_t dec;
+    Rle_Init(&dec, bmp->data);
+    int total = bmp->w * bmp->h;
+    int pos = 0;
+    while (pos < total) {
+        dec.color ^= 1;
+        int n = Rle_ReadLength(&dec);
+        if (n > total - pos) n = total - pos;
+        if (dec.color) {
+            // 游程可能跨行：逐行拆分
+            int remain = n, p = pos;
+            while (remain > 0) {
+                int row = p / bmp->w, col = p % bmp->w;
+                int k = bmp->w - col;
+                if (k > remain) k = remain;
+                uint8_t *line = dst + row * bmp->stride;
+                if (mode == MLCD_UNPACK_XOR) {
+                    XorBitRange(line, col, k);
+                } else {
+                    SetBitRange(line, col, k);
+                }
+                p += k;
+                remain -= k;
+            }
+        }
+        pos += n;
+    }
+}
+
+/**
+ * @brief 选择指定宽度的预缩放版本
+ */
+const MLCD_Bitmap_t* MLCD_AssetGetSize(const MLCD_Asset_t *asset, int w) {
+    if (!asset) return NULL;
+    if (w == asset->base.w || !asset->scaled || asset->scaled_count == 0) return &asset->base;
+
+    // 预缩放版本宽度连续递增，直接索引
+    int idx = w - asset->scaled[0].w;
+    if (idx >= 0 && idx < asset->scaled_count) return &asset->scaled[idx];
+
+    // 超出范围：在最小/最大变体与原图之间取最接近的
+    const MLCD_Bitmap_t *edge = (idx < 0) ? &asset->scaled[0] : &asset->scaled[asset->scaled_count - 1];
+    return (abs(edge->w - w) <= abs(asset->base.w - w)) ? edge : &asset->base;
+}
+
 /**
  * @brief 缩放绘制位图 (Nearest Neighbor Interpolation)
  */
@@ -585,36 +1130,132 @@ void MLCD_InvertRect(int x, int y, int w, int h) {
 }
 
 /**
- * @brief 刷新显存到屏幕 (全量刷新，解决黑影/同步问题)
+ * @brief 从显存位序的行数据中取出以 bit_pos 开始的 8 个像素
+ * 越界部分 (含负位置) 视为 0
+ */
+static inline uint8_t MLCD_FetchBits(const uint8_t *row, int stride, int bit_pos)
+{
+    int idx = bit_pos >> 3; // 算术右移，负数向下取整
+    int sh = bit_pos & 7;
+    uint16_t lo = (idx >= 0 && idx < stride) ? row[idx] : 0;
+    uint16_t hi = (idx + 1 >= 0 && idx + 1 < stride) ? row[idx + 1] : 0;
+    return (uint8_t)(((hi << 8) | lo) >> sh);
+}
+
+/**
+ * @brief 位块传输 (掩码)
+ * @param x,y 目标左上角
+ * @param w,h 目标区域尺寸 (同时作为裁剪窗口)
+ * @param src 源位图 (显存位序: bit0 为最左像素)
+ * @param src_stride 源位图每行字节数
+ * @param src_x 源位图起始列 (可为任意像素偏移)
+ */
+void MLCD_BlitMask(int x, int y, int w, int h, const uint8_t *src, int src_stride, int src_x, uint8_t color)
+{
+    if (!src) return;
+
+    // 裁剪到屏幕
+    if (x < 0) { src_x -= x; w += x; x = 0; }
+    if (y < 0) { src -= y * src_stride; h += y; y = 0; }
+    if (x + w > MLCD_WIDTH) w = MLCD_WIDTH - x;
+    if (y + h > MLCD_HEIGHT) h = MLCD_HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    int first = x >> 3;
+    int last = (x + w - 1) >> 3;
+    uint8_t first_mask = (uint8_t)(0xFF << (x & 7));
+    uint8_t last_mask = (uint8_t)(0xFF >> (7 - ((x + w - 1) & 7)));
+    int shift = src_x - x; // 目标像素 -> 源像素 的列偏移
+
+    for (int row = 0; row < h; row++) {
+        const uint8_t *s = src + row * src_stride;
+        uint8_t *d = mlcd_buffer[y + row];
+
+        for (int b = first; b <= last; b++) {
+            uint8_t bits = MLCD_FetchBits(s, src_stride, b * 8 + shift);
+            if (b == first) bits &= first_mask;
+            if (b == last) bits &= last_mask;
+
+            if (color == MLCD_COLOR_WHITE) {
+                d[b] |= bits;
+            } else {
+                d[b] &= (uint8_t)~bits;
+            }
+        }
+    }
+}
+
+void MLCD_ForceFullRefresh(void)
+{
+    refresh_force_full = true;
+}
+
+void MLCD_SetRowFilter(MLCD_RowFilter_t filter)
+{
+    row_filter = filter;
+}
+
+/**
+ * @brief 刷新显存到屏幕
+ * 组包时经过行合成回调 (如页面过渡)，直接在行包中生成输出，不修改显存；
+ * 开启局部刷新时跳过与上次发送内容相同的行，所有行都未变化时整帧不启动 SPI 会话。
  */
 void MLCD_Refresh(void)
 {
     // VCOM 位在使用外部 PWM 时可以固定为 0
     uint8_t cmd = MLCD_CMD_UPDATE;
-    
-    // 1. 启动 SPI 会话
-    HAL_GPIO_WritePin(CS_GPIO_Port, CS_Pin, GPIO_PIN_SET);
-    MLCD_SoftDelay(); // tsSCS Setup time (>6us)
+    uint8_t line_buffer[1 + MLCD_WIDTH / 8 + 1]; // Addr + Data + Dummy
+    bool session = false;
 
-    // 发送命令字节
-    HAL_SPI_Transmit(&hspi1, &cmd, 1, 100);
+    // 行合成回调只作用于本次刷新
+    MLCD_RowFilter_t filter = row_filter;
+    row_filter = NULL;
 
-    // 2. 逐行发送所有数据
-    // 即使数据没变也发送，确保屏幕与显存绝对同步，消除残影
-    uint8_t line_buffer[1 + MLCD_WIDTH / 8 + 1]; // Addr + Data + Dummy
+    // 定期全量刷新，确保屏幕与显存绝对同步，消除残影
+    bool full = refresh_force_full;
+    refresh_force_full = false;
+#if MLCD_PARTIAL_REFRESH
+    if (MLCD_FULL_REFRESH_INTERVAL > 0 && ++refresh_count >= MLCD_FULL_REFRESH_INTERVAL) {
+        full = true;
+    }
+    if (full) refresh_count = 0;
+#else
+    (void)full; // 未开启局部刷新时每帧都发送全部行
+#endif
 
     for (int line = 1; line <= MLCD_HEIGHT; line++) {
         int y = line - 1;
 
         // 组包：Addr (1) + Data (16) + Dummy (1)
         line_buffer[0] = line; // LSB First
-        memcpy(&line_buffer[1], mlcd_buffer[y], MLCD_WIDTH / 8);
+        if (filter) {
+            filter(y, &mlcd_buffer[0][0], &line_buffer[1]);
+        } else {
+            memcpy(&line_buffer[1], mlcd_buffer[y], MLCD_WIDTH / 8);
+        }
         line_buffer[17] = 0x00; // Dummy
 
-        // 一次性发送整行 (18 bytes)
+#if MLCD_PARTIAL_REFRESH
+        if (!full && memcmp(&line_buffer[1], mlcd_sent[y], MLCD_WIDTH / 8) == 0) {
+            continue; // 屏幕上已是该行内容
+        }
+        memcpy(mlcd_sent[y], &line_buffer[1], MLCD_WIDTH / 8);
+#endif
+
+        // 1. 首个需要发送的行到来时才启动 SPI 会话
+        if (!session) {
+            HAL_GPIO_WritePin(CS_GPIO_Port, CS_Pin, GPIO_PIN_SET);
+            MLCD_SoftDelay(); // tsSCS Setup time (>6us)
+            HAL_SPI_Transmit(&hspi1, &cmd, 1, 100); // 发送命令字节
+            session = true;
+        }
+
+        // 2. 一次性发送整行 (18 bytes)
         HAL_SPI_Transmit(&hspi1, line_buffer, sizeof(line_buffer), 100);
     }
-    
+
+    if (!session) return;
+
     // 3. 帧尾 Dummy (16 bits)
     uint8_t dummy16[2] = {0x00, 0x00};
     HAL_SPI_Transmit(&hspi1, dummy16, 2, 100);
@@ -624,6 +1265,75 @@ void MLCD_Refresh(void)
     MLCD_SoftDelay(); // twSCSL Interval
 }
 
+/**
+ * @brief 流式显示整屏图片 (启动画面等)
+ * 逐行解码后直接组包发送，不经过显存，也不需要整图解压缓冲区；
+ * 图片以外的区域填充背景色 (!color)。显存内容保持不变，下一次 MLCD_Refresh 会全量覆盖该画面。
+ */
+void MLCD_StreamImage(int x, int y, const MLCD_Bitmap_t *bmp, uint8_t color)
+{
+    if (!bmp || !bmp->data || bmp->stride > MLCD_WIDTH / 8) return;
+
+    uint8_t bg = (color == MLCD_COLOR_WHITE) ? 0x00 : 0xFF;
+    uint8_t line_buffer[1 + MLCD_WIDTH / 8 + 1]; // Addr + Data + Dummy
+    uint8_t row[MLCD_WIDTH / 8];
+    RleDecoder_t dec;
+    Rle_Init(&dec, bmp->data);
+
+    // 跳过屏幕上方的行 (RLE 需要解码以推进数据流)
+    int img_row = 0;
+    if (bmp->encoding != MLCD_ENC_RAW) {
+        for (; img_row < -y && img_row < bmp->h; img_row++) {
+            Rle_ReadRow(&dec, row, bmp->w, bmp->stride);
+        }
+    }
+
+    uint8_t cmd = MLCD_CMD_UPDATE;
+    HAL_GPIO_WritePin(CS_GPIO_Port, CS_Pin, GPIO_PIN_SET);
+    MLCD_SoftDelay(); // tsSCS Setup time (>6us)
+    HAL_SPI_Transmit(&hspi1, &cmd, 1, 100);
+
+    for (int line = 1; line <= MLCD_HEIGHT; line++) {
+        int r = line - 1 - y;
+
+        line_buffer[0] = line; // LSB First
+        memset(&line_buffer[1], bg, MLCD_WIDTH / 8);
+        line_buffer[17] = 0x00; // Dummy
+
+        if (r >= 0 && r < bmp->h) {
+            const uint8_t *src;
+            if (bmp->encoding == MLCD_ENC_RAW) {
+                src = bmp->data + r * bmp->stride;
+            } else {
+                Rle_ReadRow(&dec, row, bmp->w, bmp->stride);
+                src = row;
+            }
+
+            // 行内按字节移位拼接 (图片宽度之外的位为 0，无需额外裁剪)
+            for (int b = 0; b < MLCD_WIDTH / 8; b++) {
+                uint8_t bits = MLCD_FetchBits(src, bmp->stride, b * 8 - x);
+                if (color == MLCD_COLOR_WHITE) {
+                    line_buffer[1 + b] |= bits;
+                } else {
+                    line_buffer[1 + b] &= (uint8_t)~bits;
+                }
+            }
+        }
+
+        HAL_SPI_Transmit(&hspi1, line_buffer, sizeof(line_buffer), 100);
+    }
+
+    uint8_t dummy16[2] = {0x00, 0x00};
+    HAL_SPI_Transmit(&hspi1, dummy16, 2, 100);
+
+    MLCD_SoftDelay(); // thSCS Hold time
+    HAL_GPIO_WritePin(CS_GPIO_Port, CS_Pin, GPIO_PIN_RESET);
+    MLCD_SoftDelay(); // twSCSL Interval
+
+    // 屏幕内容已绕过显存改变
+    MLCD_ForceFullRefresh();
+}
+
 /**
  * @brief 设置像素
  */
@@ -664,10 +1374,13 @@ static int ComputeOutCode(int x, int y) {
 }
 
 /**
- * @brief 画线 (带裁剪的 Bresenham)
+ * @brief 将线段裁剪到屏幕范围内 (Cohen-Sutherland)
+ * @return 0 表示线段完全在屏幕外
  */
-void MLCD_DrawLine(int x0, int y0, int x1, int y1, uint8_t color)
+static int ClipLine(int *px0, int *py0, int *px1, int *py1)
 {
+    int x0 = *px0, y0 = *py0, x1 = *px1, y1 = *py1;
+
     // Cohen-Sutherland Line Clipping
     int outcode0 = ComputeOutCode(x0, y0);
     int outcode1 = ComputeOutCode(x1, y1);
@@ -710,19 +1423,206 @@ void MLCD_DrawLine(int x0, int y0, int x1, int y1, uint8_t color)
         }
     }
 
-    if (!accept) return;
+    *px0 = x0; *py0 = y0; *px1 = x1; *py1 = y1;
+    return accept;
+}
+
+// 把掩码 m 中的像素写成 ink 颜色 (0x00 黑 / 0xFF 白)
+static inline void Line_Write(uint8_t *p, uint8_t m, uint8_t ink) {
+    *p = (uint8_t)((*p & ~m) | (ink & m));
+}
 
-    // Bresenham algorithm
+/**
+ * @brief Bresenham 画线内核 (端点已裁剪到屏幕内)
+ * 直接在显存上移动字节指针和位掩码，不再逐像素调用 MLCD_SetPixel (边界检查 + 除法/取模)：
+ * - x 为主轴：同一字节、同一行内的连续像素先累积成掩码，换字节或换行时一次写入
+ * - y 为主轴：每步指针移动一行 (row stride)，x 变化时移动位掩码，跨字节时移动指针
+ * 误差项与 MLCD_SetPixel 版本的对称 Bresenham 完全一致 (主轴每步必前进)，输出逐像素相同
+ * @param pattern 按 y & 3 选取的行掩码，只写入掩码为 1 的像素 (实线为全 0xFF)
+ */
+static void Line_Kernel(int x0, int y0, int x1, int y1, uint8_t color, const uint8_t pattern[4])
+{
     int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
     int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
     int err = dx + dy, e2;
 
-    for (;;) {
-        MLCD_SetPixel(x0, y0, color);
-        if (x0 == x1 && y0 == y1) break;
-        e2 = 2 * err;
-        if (e2 >= dy) { err += dy; x0 += sx; }
-        if (e2 <= dx) { err += dx; y0 += sy; }
+    uint8_t ink = (color == MLCD_COLOR_WHITE) ? 0xFF : 0x00;
+    uint8_t *p = &mlcd_buffer[y0][x0 >> 3];
+    uint8_t bit = (uint8_t)(1 << (x0 & 7));
+    int stride = sy * (MLCD_WIDTH / 8);
+    int y = y0;
+
+    if (dx >= -dy) {
+        // x 为主轴：共 dx + 1 个像素
+        uint8_t run = 0;
+        for (int n = dx; n > 0; n--) {
+            run |= bit;
+            e2 = 2 * err;
+            err += dy;
+            bit = (sx > 0) ? (uint8_t)(bit << 1) : (uint8_t)(bit >> 1);
+            if (bit == 0 || e2 <= dx) {
+                Line_Write(p, run & pattern[y & 3], ink);
+                run = 0;
+                if (bit == 0) {
+                    p += sx;
+                    bit = (sx > 0) ? 0x01 : 0x80;
+                }
+                if (e2 <= dx) {
+                    err += dx;
+                    p += stride;
+                    y += sy;
+                }
+            }
+        }
+        Line_Write(p, (run | bit) & pattern[y & 3], ink);
+    } else {
+        // y 为主轴：共 -dy + 1 个像素，每个像素位于不同的行
+        for (int n = -dy; ; n--) {
+            Line_Write(p, bit & pattern[y & 3], ink);
+            if (n == 0) break;
+            e2 = 2 * err;
+            err += dx;
+            p += stride;
+            y += sy;
+            if (e2 >= dy) {
+                err += dy;
+                bit = (sx > 0) ? (uint8_t)(bit << 1) : (uint8_t)(bit >> 1);
+                if (bit == 0) {
+                    p += sx;
+                    bit = (sx > 0) ? 0x01 : 0x80;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief 画线 (带裁剪的 Bresenham)
+ */
+void MLCD_DrawLine(int x0, int y0, int x1, int y1, uint8_t color)
+{
+    static const uint8_t solid[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+
+    if (!ClipLine(&x0, &y0, &x1, &y1)) return;
+    Line_Kernel(x0, y0, x1, y1, color, solid);
+}
+
+// 4x4 Bayer 矩阵 (0-15)：抖动线在 bayer[y % 4][x % 4] < density 的像素处绘制，抗锯齿线/字体的阈值也由它导出
+const uint8_t mlcd_bayer4x4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+/**
+ * @brief 绘制抖动线 (屏幕空间有序抖动，线条移动时图案不会沿线“爬行”)
+ * 每个字节从 8 的倍数开始，x & 3 只取决于位号，所以 4 行的抖动图案可预先展开为字节掩码
+ * @param density 像素密度 0~16
+ */
+void MLCD_DrawLineDither(int x0, int y0, int x1, int y1, uint8_t color, uint8_t density)
+{
+    if (density == 0) return;
+    if (density >= 16) {
+        MLCD_DrawLine(x0, y0, x1, y1, color);
+        return;
+    }
+    if (!ClipLine(&x0, &y0, &x1, &y1)) return;
+
+    uint8_t pattern[4];
+    for (int r = 0; r < 4; r++) {
+        uint8_t m = 0;
+        for (int b = 0; b < 8; b++) {
+            if (mlcd_bayer4x4[r][b & 3] < density) m |= (uint8_t)(1 << b);
+        }
+        pattern[r] = m;
+    }
+    Line_Kernel(x0, y0, x1, y1, color, pattern);
+}
+
+// 抗锯齿线的单个像素：覆盖率级别 level (0~16) 超过该位置的 Bayer 阈值时点亮
+static inline void LineAA_Plot(int x, int y, int level, uint8_t ink)
+{
+    if ((unsigned)y >= MLCD_HEIGHT || (unsigned)x >= MLCD_WIDTH) return;
+    if (mlcd_bayer4x4[y & 3][x & 3] >= level) return;
+    Line_Write(&mlcd_buffer[y][x >> 3], (uint8_t)(1 << (x & 7)), ink);
+}
+
+/**
+ * @brief 绘制抗锯齿线 (Xiaolin Wu 算法，覆盖率经 Bayer 阈值转为亮灭)
+ * 沿主轴逐列求出线中心的次轴坐标 (16.16 定点)，小数部分 f 把覆盖率分给上下两个像素 (1 - f 与 f)；
+ * 两个像素的级别之和约为 density，按 4x4 Bayer 区域平均每列点亮约 density/16 个像素，与普通线的亮度一致。
+ * 阈值只取决于屏幕坐标，线条缓慢移动时像素按覆盖率逐个迁移，而不是整段跳变。
+ * 主轴方向按列裁剪，次轴方向逐像素检查，不需要 ClipLine。
+ * @param x0,y0,x1,y1 端点，单位 1/MLCD_SUBPIXEL 像素
+ * @param density 整体密度 0~16 (与深度提示配合)，16 为实线
+ */
+void MLCD_DrawLineAA(int x0, int y0, int x1, int y1, uint8_t color, uint8_t density)
+{
+    if (density == 0) return;
+    if (density > 16) density = 16;
+
+    uint8_t ink = (color == MLCD_COLOR_WHITE) ? 0xFF : 0x00;
+    int steep = abs(y1 - y0) > abs(x1 - x0);
+    int t;
+    if (steep) {
+        // 以 y 为主轴：交换坐标轴，绘制时再换回
+        t = x0; x0 = y0; y0 = t;
+        t = x1; x1 = y1; y1 = t;
+    }
+    if (x0 > x1) {
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+
+    int du = x1 - x0, dv = y1 - y0;
+    int32_t grad = du ? (int32_t)(((int64_t)dv << 16) / du) : 0; // |grad| <= 1.0 (Q16)
+
+    // 主轴裁剪 (右移为向下取整)
+    int u_max = (steep ? MLCD_HEIGHT : MLCD_WIDTH) - 1;
+    int ua = x0 >> MLCD_SUBPIXEL_BITS, ub = x1 >> MLCD_SUBPIXEL_BITS;
+    if (ua < 0) ua = 0;
+    if (ub > u_max) ub = u_max;
+    if (ua > ub) return;
+
+    // 第 ua 列中心处的次轴坐标，减去半个像素后整数部分即上方像素的行号
+    int32_t v = (int32_t)(((int64_t)y0 << (16 - MLCD_SUBPIXEL_BITS))
+              + (((int64_t)grad * ((ua << MLCD_SUBPIXEL_BITS) + MLCD_SUBPIXEL / 2 - x0)) >> MLCD_SUBPIXEL_BITS))
+              - 0x8000;
+
+    for (int u = ua; u <= ub; u++, v += grad) {
+        int r = v >> 16;
+        int f = (v >> 8) & 0xFF;
+        int level0 = ((256 - f) * density) >> 8;
+        int level1 = (f * density) >> 8;
+        if (steep) {
+            LineAA_Plot(r, u, level0, ink);
+            LineAA_Plot(r + 1, u, level1, ink);
+        } else {
+            LineAA_Plot(u, r, level0, ink);
+            LineAA_Plot(u, r + 1, level1, ink);
+        }
+    }
+}
+
+/**
+ * @brief 批量画点 (粒子等大量单像素对象)
+ * 不经过 MLCD_SetPixel：无符号比较一次完成上下界裁剪，颜色在循环外选定
+ */
+void MLCD_DrawPoints(const int16_t *xs, const int16_t *ys, int count, int frac_bits, uint8_t color)
+{
+    if (color == MLCD_COLOR_WHITE) {
+        for (int i = 0; i < count; i++) {
+            unsigned x = (unsigned)(xs[i] >> frac_bits), y = (unsigned)(ys[i] >> frac_bits);
+            if (x >= MLCD_WIDTH || y >= MLCD_HEIGHT) continue;
+            mlcd_buffer[y][x >> 3] |= (uint8_t)(1 << (x & 7));
+        }
+    } else {
+        for (int i = 0; i < count; i++) {
+            unsigned x = (unsigned)(xs[i] >> frac_bits), y = (unsigned)(ys[i] >> frac_bits);
+            if (x >= MLCD_WIDTH || y >= MLCD_HEIGHT) continue;
+            mlcd_buffer[y][x >> 3] &= (uint8_t)~(1 << (x & 7));
+        }
     }
 }
 
@@ -737,6 +1637,31 @@ void MLCD_DrawRect(int x, int y, int w, int h, uint8_t color) {
     MLCD_DrawLine(x, y + h - 1, x, y, color);
 }
 
+/**
+ * @brief 水平跨度填充 (多边形光栅化的基本单元)
+ * 首尾字节按掩码合并，中间整字节直接写入 pattern
+ */
+void MLCD_FillSpan(int y, int x0, int x1, uint8_t pattern) {
+    if (y < 0 || y >= MLCD_HEIGHT) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 > MLCD_WIDTH - 1) x1 = MLCD_WIDTH - 1;
+    if (x0 > x1) return;
+
+    uint8_t *row = mlcd_buffer[y];
+    int b0 = x0 >> 3, b1 = x1 >> 3;
+    uint8_t m0 = (uint8_t)(0xFF << (x0 & 7));
+    uint8_t m1 = (uint8_t)(0xFF >> (7 - (x1 & 7)));
+
+    if (b0 == b1) {
+        uint8_t m = m0 & m1;
+        row[b0] = (uint8_t)((row[b0] & ~m) | (pattern & m));
+        return;
+    }
+    row[b0] = (uint8_t)((row[b0] & ~m0) | (pattern & m0));
+    for (int b = b0 + 1; b < b1; b++) row[b] = pattern;
+    row[b1] = (uint8_t)((row[b1] & ~m1) | (pattern & m1));
+}
+
 /**
  * @brief 填充矩形
  */
@@ -0,0 +1,597 @@
+//
+// Generated by tools/assetgen.py - do not edit.
+// Source: assets/icons/
+// Images: assets/images/
+// Sprites: assets/sprites/
+//
+
+#include "mlcd_assets.h"
+
+static const uint8_t icon_damping_data[77] = { // 32x32, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xA4, 0xF1, 0x47, 0x6E, 0x65, 0x24, 0x2C, 0x24, 0x24, 0x16, 0x2A, 0x26, 0x13,
+    0x27, 0x28, 0x27, 0x22, 0x19, 0x26, 0x29, 0x12, 0x1A, 0x24, 0x2A, 0x11, 0x2B, 0x22, 0x2B, 0x3D,
+    0x4D, 0x2E, 0x2E, 0x2E, 0x2E, 0x2D, 0x4D, 0x3B, 0x22, 0x2B, 0x21, 0x1A, 0x24, 0x2A, 0x12, 0x19,
+    0x26, 0x29, 0x12, 0x27, 0x28, 0x27, 0x23, 0x16, 0x2A, 0x26, 0x14, 0x24, 0x2C, 0x24, 0x25, 0x6E,
+    0x67, 0x4F, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+};
+
+static const uint8_t icon_damping_data_25[57] = { // 25x25, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xF4, 0x3C, 0x35, 0x23, 0x1A, 0x13, 0x23, 0x15, 0x18, 0x15, 0x12, 0x25, 0x26, 0x25,
+    0x21, 0x17, 0x24, 0x27, 0x39, 0x12, 0x19, 0x2A, 0x4A, 0x1B, 0x2B, 0x1A, 0x4A, 0x29, 0x12, 0x19,
+    0x11, 0x18, 0x14, 0x18, 0x11, 0x17, 0x24, 0x27, 0x12, 0x15, 0x18, 0x15, 0x13, 0x23, 0x1A, 0x13,
+    0x24, 0x5A, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+};
+
+static const uint8_t icon_damping_data_26[58] = { // 26x26, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xF7, 0x3D, 0x36, 0x5B, 0x54, 0x15, 0x19, 0x15, 0x12, 0x26, 0x17, 0x16, 0x21, 0x17,
+    0x25, 0x27, 0x11, 0x18, 0x23, 0x28, 0x2B, 0x3B, 0x1C, 0x1C, 0x1C, 0x1C, 0x1B, 0x3C, 0x18, 0x23,
+    0x28, 0x11, 0x17, 0x25, 0x27, 0x11, 0x26, 0x17, 0x16, 0x22, 0x15, 0x19, 0x15, 0x13, 0x23, 0x29,
+    0x23, 0x25, 0x3D, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+};
+
+static const uint8_t icon_damping_data_27[61] = { // 27x27, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFA, 0x3E, 0x36, 0x5C, 0x54, 0x23, 0x2A, 0x23, 0x22, 0x26, 0x26, 0x26, 0x21, 0x18,
+    0x16, 0x18, 0x11, 0x19, 0x14, 0x19, 0x39, 0x22, 0x29, 0x2B, 0x4B, 0x1C, 0x2C, 0x1B, 0x4B, 0x29,
+    0x22, 0x29, 0x11, 0x19, 0x14, 0x19, 0x11, 0x18, 0x16, 0x18, 0x11, 0x26, 0x26, 0x26, 0x22, 0x23,
+    0x2A, 0x23, 0x24, 0x5C, 0x56, 0x3E, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+};
+
+static const uint8_t icon_damping_data_28[64] = { // 28x28, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFD, 0x3E, 0x46, 0x5D, 0x54, 0x23, 0x2B, 0x14, 0x23, 0x15, 0x29, 0x25, 0x12, 0x18,
+    0x25, 0x28, 0x11, 0x19, 0x23, 0x29, 0x3A, 0x21, 0x2A, 0x2C, 0x3C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C,
+    0x3D, 0x19, 0x23, 0x29, 0x11, 0x18, 0x25, 0x28, 0x11, 0x26, 0x27, 0x26, 0x22, 0x15, 0x29, 0x25,
+    0x13, 0x23, 0x2B, 0x14, 0x24, 0x5D, 0x56, 0x3E, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+};
+
+static const uint8_t icon_damping_data_29[68] = { // 29x29, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0x14, 0xE4, 0x66, 0xC6, 0x42, 0x42, 0xA2, 0x42, 0x31, 0x61, 0xA1, 0x61, 0x22,
+    0x71, 0x81, 0x72, 0x11, 0x82, 0x62, 0x81, 0x11, 0x92, 0x42, 0x92, 0xC4, 0xC1, 0xD2, 0xD1, 0xD2,
+    0xD1, 0xC4, 0xC2, 0xA2, 0x22, 0xA1, 0x11, 0x92, 0x42, 0x91, 0x11, 0x82, 0x62, 0x81, 0x12, 0x71,
+    0x81, 0x72, 0x21, 0x61, 0xA1, 0x61, 0x32, 0x42, 0xA2, 0x42, 0x54, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA,
+};
+
+static const uint8_t icon_damping_data_30[71] = { // 30x30, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0x44, 0xF0, 0x46, 0x6D, 0x64, 0x24, 0x2B, 0x24, 0x23, 0x16, 0x29, 0x26, 0x12,
+    0x27, 0x27, 0x27, 0x21, 0x19, 0x25, 0x29, 0x11, 0x1A, 0x23, 0x2A, 0x3B, 0x21, 0x2B, 0x2D, 0x3D,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x3E, 0x1A, 0x23, 0x2A, 0x11, 0x19, 0x25, 0x29, 0x11, 0x27, 0x27,
+    0x27, 0x22, 0x16, 0x29, 0x26, 0x13, 0x24, 0x2B, 0x24, 0x24, 0x6D, 0x66, 0x4F, 0x04, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+};
+
+static const uint8_t icon_damping_data_31[75] = { // 31x31, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0x74, 0xF1, 0x46, 0x6E, 0x64, 0x24, 0x2C, 0x24, 0x23, 0x16, 0x2A, 0x26, 0x12,
+    0x27, 0x28, 0x27, 0x21, 0x19, 0x26, 0x29, 0x11, 0x1A, 0x24, 0x2A, 0x3B, 0x22, 0x2B, 0x2D, 0x4D,
+    0x1E, 0x2E, 0x1E, 0x2E, 0x1D, 0x4D, 0x2B, 0x22, 0x2B, 0x11, 0x1A, 0x24, 0x2A, 0x11, 0x19, 0x26,
+    0x29, 0x11, 0x27, 0x28, 0x27, 0x22, 0x16, 0x2A, 0x26, 0x13, 0x24, 0x2C, 0x24, 0x24, 0x6E, 0x66,
+    0x4F, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+};
+
+static const uint8_t icon_damping_data_32[77] = { // 32x32, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xA4, 0xF1, 0x47, 0x6E, 0x65, 0x24, 0x2C, 0x24, 0x24, 0x16, 0x2A, 0x26, 0x13,
+    0x27, 0x28, 0x27, 0x22, 0x19, 0x26, 0x29, 0x12, 0x1A, 0x24, 0x2A, 0x11, 0x2B, 0x22, 0x2B, 0x3D,
+    0x4D, 0x2E, 0x2E, 0x2E, 0x2E, 0x2D, 0x4D, 0x3B, 0x22, 0x2B, 0x21, 0x1A, 0x24, 0x2A, 0x12, 0x19,
+    0x26, 0x29, 0x12, 0x27, 0x28, 0x27, 0x23, 0x16, 0x2A, 0x26, 0x14, 0x24, 0x2C, 0x24, 0x25, 0x6E,
+    0x67, 0x4F, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+};
+
+static const uint8_t icon_damping_data_33[79] = { // 33x33, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x4F, 0x14, 0x86, 0xE6, 0x62, 0x42, 0xC2, 0x42, 0x51, 0x62, 0xA2,
+    0x61, 0x42, 0x72, 0x82, 0x72, 0x31, 0x92, 0x62, 0x91, 0x31, 0xA2, 0x42, 0xA1, 0x13, 0xB2, 0x22,
+    0xB4, 0xD4, 0xD3, 0xE2, 0xE3, 0xE2, 0xE3, 0xD4, 0xD4, 0xB2, 0x22, 0xB2, 0x21, 0xA2, 0x42, 0xA1,
+    0x31, 0x92, 0x62, 0x91, 0x32, 0x72, 0x82, 0x72, 0x41, 0x62, 0xA2, 0x61, 0x52, 0x42, 0xC2, 0x42,
+    0x66, 0xE6, 0x84, 0xF1, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
+};
+
+static const uint8_t icon_damping_data_34[84] = { // 34x34, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x4F, 0x24, 0x86, 0xF0, 0x66, 0x24, 0x2D, 0x24, 0x25, 0x16, 0x2B,
+    0x26, 0x14, 0x27, 0x29, 0x27, 0x23, 0x19, 0x27, 0x29, 0x13, 0x1A, 0x25, 0x2A, 0x11, 0x3B, 0x23,
+    0x2B, 0x4D, 0x5D, 0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x5D, 0x4B, 0x23, 0x2B, 0x22, 0x1A, 0x25, 0x2A,
+    0x13, 0x1A, 0x25, 0x2A, 0x13, 0x19, 0x27, 0x29, 0x13, 0x27, 0x29, 0x27, 0x24, 0x16, 0x2B, 0x26,
+    0x15, 0x24, 0x2D, 0x24, 0x26, 0x6F, 0x06, 0x84, 0xF2, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFA,
+};
+
+static const uint8_t icon_damping_data_35[88] = { // 35x35, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x4F, 0x34, 0x86, 0xF1, 0x66, 0x24, 0x2E, 0x24, 0x25, 0x16, 0x3A,
+    0x36, 0x14, 0x27, 0x38, 0x37, 0x23, 0x1A, 0x26, 0x2A, 0x13, 0x1B, 0x24, 0x2B, 0x11, 0x3C, 0x22,
+    0x2C, 0x5C, 0x22, 0x2C, 0x4E, 0x4E, 0x3F, 0x02, 0xF0, 0x3F, 0x02, 0xF0, 0x3E, 0x4E, 0x4C, 0x22,
+    0x2C, 0x22, 0x1B, 0x24, 0x2B, 0x13, 0x1A, 0x26, 0x2A, 0x13, 0x27, 0x38, 0x37, 0x24, 0x16, 0x3A,
+    0x36, 0x15, 0x24, 0x2E, 0x24, 0x26, 0x6F, 0x16, 0x76, 0xF1, 0x68, 0x4F, 0x34, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+};
+
+static const uint8_t icon_damping_data_36[92] = { // 36x36, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x4F, 0x35, 0x87, 0xF0, 0x76, 0x24, 0x3D, 0x25, 0x25, 0x17, 0x2B,
+    0x27, 0x14, 0x28, 0x29, 0x28, 0x23, 0x1A, 0x27, 0x2A, 0x13, 0x1A, 0x27, 0x2A, 0x13, 0x1B, 0x25,
+    0x2B, 0x11, 0x3C, 0x23, 0x2C, 0x4E, 0x5E, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x5E, 0x4C,
+    0x23, 0x2C, 0x22, 0x1B, 0x25, 0x2B, 0x13, 0x1B, 0x25, 0x2B, 0x13, 0x1A, 0x27, 0x2A, 0x13, 0x28,
+    0x29, 0x28, 0x24, 0x17, 0x2B, 0x27, 0x15, 0x24, 0x3D, 0x25, 0x26, 0x7F, 0x07, 0x84, 0xF3, 0x5F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+};
+
+static const uint8_t icon_damping_data_37[98] = { // 37x37, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xF3, 0x58, 0x7F, 0x17, 0x62, 0x52, 0xE2, 0x52, 0x51, 0x72,
+    0xC2, 0x71, 0x51, 0x72, 0xC2, 0x71, 0x42, 0x82, 0xA2, 0x82, 0x31, 0xA3, 0x63, 0xA1, 0x31, 0xB3,
+    0x43, 0xB1, 0x13, 0xD2, 0x22, 0xD4, 0xF0, 0x4F, 0x03, 0xF1, 0x2F, 0x13, 0xF1, 0x2F, 0x13, 0xF1,
+    0x2F, 0x13, 0xF0, 0x4F, 0x04, 0xD2, 0x22, 0xD2, 0x21, 0xB3, 0x43, 0xB1, 0x31, 0xA3, 0x63, 0xA1,
+    0x32, 0x82, 0xA2, 0x82, 0x41, 0x72, 0xC2, 0x71, 0x51, 0x72, 0xC2, 0x71, 0x52, 0x52, 0xE2, 0x52,
+    0x67, 0xF1, 0x78, 0x5F, 0x35, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0,
+};
+
+static const uint8_t icon_damping_data_38[102] = { // 38x38, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xF4, 0x58, 0x7F, 0x27, 0x62, 0x52, 0xF0, 0x25, 0x25, 0x25,
+    0x2F, 0x02, 0x52, 0x51, 0x73, 0xB3, 0x71, 0x42, 0x83, 0x93, 0x82, 0x31, 0xB2, 0x72, 0xB1, 0x31,
+    0xC2, 0x52, 0xC1, 0x13, 0xD2, 0x32, 0xD5, 0xD2, 0x32, 0xD4, 0xF0, 0x5F, 0x03, 0xF1, 0x3F, 0x13,
+    0xF1, 0x3F, 0x13, 0xF0, 0x5F, 0x04, 0xD2, 0x32, 0xD2, 0x21, 0xC2, 0x52, 0xC1, 0x31, 0xC2, 0x52,
+    0xC1, 0x31, 0xB2, 0x72, 0xB1, 0x32, 0x83, 0x93, 0x82, 0x41, 0x73, 0xB3, 0x71, 0x52, 0x52, 0xF0,
+    0x25, 0x26, 0x7F, 0x27, 0x77, 0xF2, 0x78, 0x5F, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+};
+
+static const MLCD_Bitmap_t icon_damping_scaled[14] = {
+    {icon_damping_data_25, 25, 25, 4, MLCD_ENC_RLE},
+    {icon_damping_data_26, 26, 26, 4, MLCD_ENC_RLE},
+    {icon_damping_data_27, 27, 27, 4, MLCD_ENC_RLE},
+    {icon_damping_data_28, 28, 28, 4, MLCD_ENC_RLE},
+    {icon_damping_data_29, 29, 29, 4, MLCD_ENC_RLE},
+    {icon_damping_data_30, 30, 30, 4, MLCD_ENC_RLE},
+    {icon_damping_data_31, 31, 31, 4, MLCD_ENC_RLE},
+    {icon_damping_data_32, 32, 32, 4, MLCD_ENC_RLE},
+    {icon_damping_data_33, 33, 33, 5, MLCD_ENC_RLE},
+    {icon_damping_data_34, 34, 34, 5, MLCD_ENC_RLE},
+    {icon_damping_data_35, 35, 35, 5, MLCD_ENC_RLE},
+    {icon_damping_data_36, 36, 36, 5, MLCD_ENC_RLE},
+    {icon_damping_data_37, 37, 37, 5, MLCD_ENC_RLE},
+    {icon_damping_data_38, 38, 38, 5, MLCD_ENC_RLE},
+};
+
+const MLCD_Asset_t icon_damping = {
+    .base = {icon_damping_data, 32, 32, 4, MLCD_ENC_RLE},
+    .scaled = icon_damping_scaled,
+    .scaled_count = 14,
+};
+
+static const uint8_t icon_display_data[81] = { // 32x32, stride 4, MLCD_ENC_RLE
+    0x08, 0x56, 0x5F, 0x15, 0x56, 0xF1, 0x64, 0x6F, 0x34, 0x44, 0xD2, 0x6A, 0x71, 0x36, 0x5A, 0x5C,
+    0x68, 0x6D, 0x66, 0x6E, 0x83, 0x77, 0x45, 0xF0, 0x48, 0x7A, 0x79, 0x86, 0x98, 0x96, 0x97, 0xB4,
+    0xB6, 0x43, 0x44, 0x43, 0x46, 0x35, 0x34, 0x35, 0x36, 0x35, 0x34, 0x35, 0x45, 0x43, 0x44, 0x43,
+    0x46, 0xB4, 0xB7, 0x96, 0x99, 0x87, 0x88, 0x7A, 0x78, 0x4F, 0x14, 0x48, 0x64, 0x7E, 0x66, 0x6D,
+    0x68, 0x6C, 0x5A, 0x56, 0xB5, 0x14, 0xF6, 0x44, 0x3F, 0x46, 0x46, 0xF1, 0x64, 0x6F, 0x15, 0x74,
+    0x80,
+};
+
+static const uint8_t icon_display_data_25[62] = { // 25x25, stride 4, MLCD_ENC_RLE
+    0x07, 0x44, 0x4D, 0x44, 0x4D, 0x44, 0x4E, 0x34, 0x37, 0x54, 0x84, 0x95, 0x65, 0xA5, 0x45, 0xB6,
+    0x35, 0x54, 0x58, 0x57, 0x74, 0x77, 0x74, 0x76, 0x32, 0x34, 0x32, 0x35, 0x24, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x24, 0x34, 0x32, 0x34, 0x32, 0x36, 0x74, 0x77, 0x75, 0x67, 0x58, 0x53, 0x74, 0x45,
+    0xB5, 0x45, 0xA5, 0x65, 0x94, 0x84, 0x48, 0x34, 0x2F, 0x04, 0x44, 0xD4, 0x44, 0x60,
+};
+
+static const uint8_t icon_display_data_26[64] = { // 26x26, stride 4, MLCD_ENC_RLE
+    0x07, 0x45, 0x4D, 0x44, 0x5D, 0x53, 0x5F, 0x03, 0x33, 0xB2, 0x49, 0x51, 0x25, 0x57, 0x5A, 0x55,
+    0x5B, 0x72, 0x65, 0x44, 0xC3, 0x86, 0x57, 0x77, 0x57, 0x69, 0x39, 0x53, 0x33, 0x33, 0x33, 0x52,
+    0x43, 0x33, 0x43, 0x43, 0x33, 0x33, 0x33, 0x59, 0x39, 0x67, 0x57, 0x86, 0x66, 0x73, 0xD3, 0x37,
+    0x53, 0x6B, 0x55, 0x5A, 0x57, 0x54, 0x94, 0x14, 0xF2, 0x33, 0x3F, 0x05, 0x35, 0xD5, 0x35, 0x60,
+};
+
+static const uint8_t icon_display_data_27[68] = { // 27x27, stride 4, MLCD_ENC_RLE
+    0x07, 0x46, 0x4D, 0x45, 0x5D, 0x54, 0x5F, 0x03, 0x43, 0xB2, 0x58, 0x61, 0x26, 0x48, 0x4B, 0x56,
+    0x5B, 0x73, 0x65, 0x44, 0xD3, 0x76, 0x86, 0x86, 0x67, 0x69, 0x49, 0x53, 0x33, 0x43, 0x33, 0x53,
+    0x42, 0x42, 0x43, 0x53, 0x42, 0x42, 0x44, 0x43, 0x33, 0x43, 0x33, 0x59, 0x49, 0x76, 0x67, 0x76,
+    0x86, 0x73, 0xE3, 0x37, 0x54, 0x6B, 0x56, 0x5B, 0x48, 0x45, 0xA4, 0x13, 0xF3, 0x34, 0x2F, 0x15,
+    0x45, 0xD5, 0x45, 0x60,
+};
+
+static const uint8_t icon_display_data_28[68] = { // 28x28, stride 4, MLCD_ENC_RLE
+    0x07, 0x55, 0x4E, 0x54, 0x5E, 0x63, 0x5F, 0x14, 0x34, 0xB2, 0x59, 0x61, 0x26, 0x49, 0x4B, 0x57,
+    0x5C, 0x72, 0x66, 0x44, 0xD4, 0x76, 0x96, 0x87, 0x58, 0x78, 0x58, 0x6A, 0x3A, 0x54, 0x24, 0x34,
+    0x24, 0x53, 0x43, 0x33, 0x44, 0x44, 0x24, 0x34, 0x24, 0x5A, 0x3A, 0x68, 0x58, 0x87, 0x67, 0x76,
+    0x96, 0x73, 0xE4, 0x37, 0x55, 0x5C, 0x57, 0x5B, 0x49, 0x45, 0xA4, 0x14, 0xF3, 0x43, 0x3F, 0x16,
+    0x35, 0xE6, 0x35, 0x70,
+};
+
+static const uint8_t icon_display_data_29[73] = { // 29x29, stride 4, MLCD_ENC_RLE
+    0x08, 0x46, 0x4F, 0x04, 0x55, 0xF0, 0x54, 0x5F, 0x23, 0x43, 0xC2, 0x5A, 0x61, 0x26, 0x4A, 0x4B,
+    0x58, 0x5C, 0x56, 0x5D, 0x73, 0x66, 0x45, 0xD4, 0x87, 0x68, 0x78, 0x68, 0x6A, 0x4A, 0x54, 0x33,
+    0x43, 0x34, 0x53, 0x43, 0x43, 0x43, 0x53, 0x43, 0x43, 0x44, 0x44, 0x33, 0x43, 0x34, 0x5A, 0x4A,
+    0x68, 0x68, 0x87, 0x77, 0x74, 0xE4, 0x38, 0x54, 0x6D, 0x56, 0x5C, 0x58, 0x5B, 0x4A, 0x45, 0xA5,
+    0x14, 0xF4, 0x34, 0x3F, 0x25, 0x45, 0xF0, 0x54, 0x57,
+};
+
+static const uint8_t icon_display_data_30[74] = { // 30x30, stride 4, MLCD_ENC_RLE
+    0x08, 0x55, 0x5F, 0x05, 0x46, 0xF0, 0x63, 0x6F, 0x24, 0x34, 0xC2, 0x69, 0x71, 0x26, 0x59, 0x5B,
+    0x67, 0x6C, 0x65, 0x6D, 0x82, 0x76, 0x45, 0xE4, 0x77, 0x97, 0x88, 0x59, 0x79, 0x59, 0x6B, 0x3B,
+    0x54, 0x34, 0x34, 0x34, 0x53, 0x53, 0x33, 0x54, 0x44, 0x34, 0x34, 0x34, 0x5B, 0x3B, 0x69, 0x59,
+    0x88, 0x68, 0x77, 0x97, 0x74, 0xF0, 0x43, 0x86, 0x37, 0xD6, 0x56, 0xC6, 0x76, 0xB5, 0x95, 0x5B,
+    0x41, 0x4F, 0x54, 0x33, 0xF3, 0x63, 0x6F, 0x06, 0x36, 0x70,
+};
+
+static const uint8_t icon_display_data_31[78] = { // 31x31, stride 4, MLCD_ENC_RLE
+    0x08, 0x56, 0x5F, 0x05, 0x56, 0xF0, 0x64, 0x6F, 0x24, 0x44, 0xC2, 0x6A, 0x71, 0x26, 0x5A, 0x5B,
+    0x68, 0x6C, 0x66, 0x6D, 0x83, 0x76, 0x45, 0xF0, 0x47, 0x7A, 0x78, 0x86, 0x97, 0x96, 0x96, 0xB4,
+    0xB5, 0x43, 0x44, 0x43, 0x45, 0x35, 0x34, 0x35, 0x35, 0x35, 0x34, 0x35, 0x44, 0x43, 0x44, 0x43,
+    0x45, 0xB4, 0xB6, 0x96, 0x98, 0x87, 0x87, 0x7A, 0x77, 0x4F, 0x14, 0x38, 0x64, 0x7D, 0x66, 0x6C,
+    0x68, 0x6B, 0x5A, 0x55, 0xB5, 0x14, 0xF5, 0x44, 0x3F, 0x36, 0x46, 0xF0, 0x64, 0x67,
+};
+
+static const uint8_t icon_display_data_32[81] = { // 32x32, stride 4, MLCD_ENC_RLE
+    0x08, 0x56, 0x5F, 0x15, 0x56, 0xF1, 0x64, 0x6F, 0x34, 0x44, 0xD2, 0x6A, 0x71, 0x36, 0x5A, 0x5C,
+    0x68, 0x6D, 0x66, 0x6E, 0x83, 0x77, 0x45, 0xF0, 0x48, 0x7A, 0x79, 0x86, 0x98, 0x96, 0x97, 0xB4,
+    0xB6, 0x43, 0x44, 0x43, 0x46, 0x35, 0x34, 0x35, 0x36, 0x35, 0x34, 0x35, 0x45, 0x43, 0x44, 0x43,
+    0x46, 0xB4, 0xB7, 0x96, 0x99, 0x87, 0x88, 0x7A, 0x78, 0x4F, 0x14, 0x48, 0x64, 0x7E, 0x66, 0x6D,
+    0x68, 0x6C, 0x5A, 0x56, 0xB5, 0x14, 0xF6, 0x44, 0x3F, 0x46, 0x46, 0xF1, 0x64, 0x6F, 0x15, 0x74,
+    0x80,
+};
+
+static const uint8_t icon_display_data_33[84] = { // 33x33, stride 5, MLCD_ENC_RLE
+    0x09, 0x56, 0x5F, 0x25, 0x65, 0xF2, 0x55, 0x6F, 0x26, 0x46, 0xF4, 0x44, 0x4E, 0x26, 0xA7, 0x13,
+    0x75, 0xA5, 0xD6, 0x86, 0xE6, 0x66, 0xF0, 0x83, 0x77, 0x55, 0xF0, 0x49, 0x7A, 0x7A, 0x86, 0x99,
+    0x96, 0x98, 0xB4, 0xB7, 0x43, 0x44, 0x43, 0x47, 0x35, 0x34, 0x35, 0x37, 0x35, 0x34, 0x35, 0x46,
+    0x43, 0x44, 0x43, 0x47, 0xB4, 0xB8, 0x96, 0x9A, 0x87, 0x89, 0x7A, 0x79, 0x4F, 0x14, 0x49, 0x64,
+    0x7F, 0x06, 0x66, 0xE6, 0x86, 0xD5, 0xA5, 0x6C, 0x51, 0x4F, 0x74, 0x43, 0xF5, 0x64, 0x6F, 0x26,
+    0x46, 0xF2, 0x57, 0x48,
+};
+
+static const uint8_t icon_display_data_34[88] = { // 34x34, stride 5, MLCD_ENC_RLE
+    0x09, 0x57, 0x5F, 0x25, 0x75, 0xF2, 0x56, 0x6F, 0x26, 0x56, 0xF4, 0x45, 0x4E, 0x26, 0xB7, 0x13,
+    0x75, 0xB5, 0xD6, 0x96, 0xE6, 0x76, 0xF0, 0x84, 0x77, 0x55, 0xF1, 0x49, 0x7B, 0x7A, 0x87, 0x99,
+    0x97, 0x98, 0xB5, 0xB7, 0x43, 0x45, 0x43, 0x47, 0x35, 0x35, 0x35, 0x37, 0x35, 0x35, 0x35, 0x46,
+    0x35, 0x35, 0x35, 0x46, 0x43, 0x45, 0x43, 0x47, 0xB5, 0xB8, 0x97, 0x9A, 0x88, 0x89, 0x7B, 0x79,
+    0x4F, 0x24, 0x49, 0x65, 0x7F, 0x06, 0x76, 0xE6, 0x96, 0xD5, 0xB5, 0x6C, 0x52, 0x4F, 0x74, 0x53,
+    0xF5, 0x65, 0x6F, 0x26, 0x56, 0xF2, 0x58, 0x48,
+};
+
+static const uint8_t icon_display_data_35[88] = { // 35x35, stride 5, MLCD_ENC_RLE
+    0x09, 0x66, 0x6F, 0x26, 0x66, 0xF2, 0x65, 0x7F, 0x27, 0x47, 0xF4, 0x54, 0x5E, 0x27, 0xA8, 0x13,
+    0x76, 0xA6, 0xD7, 0x87, 0xE7, 0x67, 0xF0, 0x93, 0x87, 0x55, 0xF2, 0x49, 0x8A, 0x89, 0x8A, 0x8A,
+    0x96, 0xA9, 0xA6, 0xA8, 0xC4, 0xC7, 0x43, 0x54, 0x53, 0x47, 0x36, 0x34, 0x36, 0x37, 0x36, 0x34,
+    0x36, 0x46, 0x43, 0x54, 0x53, 0x47, 0xC4, 0xC8, 0xA6, 0xAA, 0x97, 0x99, 0x8A, 0x89, 0x8A, 0x89,
+    0x4F, 0x34, 0x49, 0x74, 0x8F, 0x07, 0x67, 0xE7, 0x87, 0xD6, 0xA6, 0x6D, 0x51, 0x4F, 0x85, 0x43,
+    0xF6, 0x74, 0x7F, 0x27, 0x47, 0xF2, 0x67, 0x58,
+};
+
+static const uint8_t icon_display_data_36[94] = { // 36x36, stride 5, MLCD_ENC_RLE
+    0x09, 0x67, 0x5F, 0x36, 0x75, 0xF3, 0x66, 0x6F, 0x37, 0x56, 0xF6, 0x45, 0x4F, 0x02, 0x7B, 0x81,
+    0x37, 0x6B, 0x6D, 0x79, 0x7E, 0x77, 0x7F, 0x09, 0x48, 0xF0, 0x94, 0x87, 0x56, 0xF1, 0x59, 0x8B,
+    0x8A, 0x97, 0xA9, 0xA7, 0xA8, 0xC5, 0xC7, 0x44, 0x45, 0x44, 0x47, 0x36, 0x35, 0x36, 0x37, 0x36,
+    0x35, 0x36, 0x46, 0x36, 0x35, 0x36, 0x46, 0x44, 0x45, 0x44, 0x47, 0xC5, 0xC8, 0xA7, 0xAA, 0x98,
+    0x99, 0x8B, 0x89, 0x4F, 0x35, 0x49, 0x75, 0x8F, 0x07, 0x77, 0xF0, 0x77, 0x7E, 0x79, 0x7D, 0x6B,
+    0x66, 0xD5, 0x24, 0xF9, 0x45, 0x3F, 0x67, 0x56, 0xF3, 0x75, 0x6F, 0x36, 0x84, 0x90,
+};
+
+static const uint8_t icon_display_data_37[94] = { // 37x37, stride 5, MLCD_ENC_RLE
+    0x0A, 0x66, 0x6F, 0x46, 0x66, 0xF4, 0x65, 0x7F, 0x47, 0x47, 0xF6, 0x54, 0x5F, 0x02, 0x7C, 0x81,
+    0x37, 0x6C, 0x6D, 0x7A, 0x7D, 0x7A, 0x7F, 0x07, 0x67, 0xF2, 0x93, 0x88, 0x56, 0xF2, 0x59, 0x8C,
+    0x8A, 0xA6, 0xB9, 0xB6, 0xB9, 0xB6, 0xB8, 0xD4, 0xD7, 0x53, 0x54, 0x53, 0x57, 0x36, 0x44, 0x46,
+    0x37, 0x36, 0x44, 0x46, 0x46, 0x53, 0x54, 0x53, 0x57, 0xD4, 0xD8, 0xB6, 0xB9, 0xB6, 0xBA, 0xA8,
+    0x99, 0x8C, 0x89, 0x5F, 0x35, 0x4A, 0x74, 0x8F, 0x27, 0x67, 0xF0, 0x7A, 0x7D, 0x7A, 0x7D, 0x6C,
+    0x66, 0xD6, 0x15, 0xF9, 0x54, 0x4F, 0x77, 0x47, 0xF4, 0x74, 0x7F, 0x46, 0x84, 0x90,
+};
+
+static const uint8_t icon_display_data_38[100] = { // 38x38, stride 5, MLCD_ENC_RLE
+    0x0A, 0x67, 0x6F, 0x46, 0x76, 0xF4, 0x66, 0x7F, 0x47, 0x57, 0xF6, 0x55, 0x5F, 0x02, 0x8B, 0x91,
+    0x38, 0x6B, 0x6F, 0x06, 0xB6, 0xF0, 0x79, 0x7F, 0x17, 0x77, 0xF2, 0x94, 0x88, 0x56, 0xF3, 0x59,
+    0x9B, 0x99, 0x9B, 0x9A, 0xA7, 0xB9, 0xB7, 0xB8, 0xD5, 0xD7, 0x53, 0x55, 0x53, 0x57, 0x46, 0x35,
+    0x36, 0x47, 0x46, 0x35, 0x36, 0x56, 0x46, 0x35, 0x36, 0x56, 0x53, 0x55, 0x53, 0x57, 0xD5, 0xD8,
+    0xB7, 0xBA, 0xA8, 0xA9, 0x9B, 0x99, 0x9B, 0x99, 0x5F, 0x45, 0x4A, 0x75, 0x8F, 0x27, 0x77, 0xF1,
+    0x79, 0x7F, 0x06, 0xB6, 0xF0, 0x6B, 0x67, 0xE5, 0x24, 0xFA, 0x55, 0x3F, 0x87, 0x57, 0xF4, 0x75,
+    0x7F, 0x46, 0x85, 0x90,
+};
+
+static const MLCD_Bitmap_t icon_display_scaled[14] = {
+    {icon_display_data_25, 25, 25, 4, MLCD_ENC_RLE},
+    {icon_display_data_26, 26, 26, 4, MLCD_ENC_RLE},
+    {icon_display_data_27, 27, 27, 4, MLCD_ENC_RLE},
+    {icon_display_data_28, 28, 28, 4, MLCD_ENC_RLE},
+    {icon_display_data_29, 29, 29, 4, MLCD_ENC_RLE},
+    {icon_display_data_30, 30, 30, 4, MLCD_ENC_RLE},
+    {icon_display_data_31, 31, 31, 4, MLCD_ENC_RLE},
+    {icon_display_data_32, 32, 32, 4, MLCD_ENC_RLE},
+    {icon_display_data_33, 33, 33, 5, MLCD_ENC_RLE},
+    {icon_display_data_34, 34, 34, 5, MLCD_ENC_RLE},
+    {icon_display_data_35, 35, 35, 5, MLCD_ENC_RLE},
+    {icon_display_data_36, 36, 36, 5, MLCD_ENC_RLE},
+    {icon_display_data_37, 37, 37, 5, MLCD_ENC_RLE},
+    {icon_display_data_38, 38, 38, 5, MLCD_ENC_RLE},
+};
+
+const MLCD_Asset_t icon_display = {
+    .base = {icon_display_data, 32, 32, 4, MLCD_ENC_RLE},
+    .scaled = icon_display_scaled,
+    .scaled_count = 14,
+};
+
+static const uint8_t icon_theme_data[57] = { // 32x32, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xF2, 0x6F, 0x9A, 0xF6, 0xCF, 0x4E, 0xF2, 0xF1, 0xF0, 0xF3, 0xEF, 0x3D, 0xF5, 0xC6,
+    0x86, 0xB6, 0xA6, 0xA5, 0xC5, 0x95, 0xE5, 0x84, 0xF1, 0x48, 0x4F, 0x14, 0x84, 0xF1, 0x48, 0x4F,
+    0x14, 0x85, 0xE5, 0x95, 0xC5, 0xA6, 0xA6, 0xB6, 0x86, 0xCF, 0x5D, 0xF3, 0xEF, 0x3F, 0x0F, 0x1F,
+    0x2E, 0xF4, 0xCF, 0x6A, 0xF9, 0x6F, 0xFF, 0xFF, 0x20,
+};
+
+static const uint8_t icon_theme_data_25[38] = { // 25x25, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0x14, 0xF4, 0x8F, 0x1A, 0xEC, 0xCE, 0xBE, 0xA5, 0x65, 0x85, 0x85, 0x74, 0xA4, 0x73,
+    0xC3, 0x73, 0xC3, 0x73, 0xC3, 0x73, 0xC3, 0x74, 0xA4, 0x75, 0x85, 0x85, 0x65, 0xAE, 0xBE, 0xCC,
+    0xEA, 0xF1, 0x8F, 0x44, 0xFF, 0x50,
+};
+
+static const uint8_t icon_theme_data_26[42] = { // 26x26, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0x35, 0xF4, 0x9F, 0x29, 0xF0, 0xDC, 0xF0, 0xBF, 0x0A, 0xF2, 0x94, 0x94, 0x94, 0x94,
+    0x84, 0xB4, 0x73, 0xD3, 0x73, 0xD3, 0x73, 0xD3, 0x74, 0xB4, 0x84, 0x94, 0x94, 0x94, 0x9F, 0x2A,
+    0xF0, 0xBF, 0x0C, 0xDF, 0x09, 0xF2, 0x9F, 0x45, 0xFF, 0x60,
+};
+
+static const uint8_t icon_theme_data_27[44] = { // 27x27, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0x56, 0xF5, 0x8F, 0x3A, 0xF1, 0xCD, 0xF1, 0xBF, 0x1B, 0xF1, 0xB5, 0x65, 0xA5, 0x85,
+    0x84, 0xC4, 0x73, 0xE3, 0x73, 0xE3, 0x73, 0xE3, 0x73, 0xE3, 0x74, 0xC4, 0x85, 0x85, 0xA5, 0x65,
+    0xBF, 0x1B, 0xF1, 0xBF, 0x1D, 0xCF, 0x1A, 0xF3, 0x8F, 0x56, 0xFF, 0x70,
+};
+
+static const uint8_t icon_theme_data_28[45] = { // 28x28, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0x85, 0xF6, 0x9F, 0x3B, 0xF1, 0xDE, 0xEE, 0xF0, 0xCF, 0x2B, 0x57, 0x5A, 0x59, 0x59,
+    0x4B, 0x48, 0x4D, 0x47, 0x3E, 0x47, 0x3E, 0x47, 0x3E, 0x47, 0x4D, 0x48, 0x4B, 0x49, 0x59, 0x5A,
+    0x57, 0x5B, 0xF2, 0xCF, 0x0D, 0xEF, 0x0D, 0xF1, 0xBF, 0x39, 0xF6, 0x5F, 0xF9,
+};
+
+static const uint8_t icon_theme_data_29[47] = { // 29x29, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xA6, 0xF6, 0xAF, 0x4A, 0xF3, 0xCF, 0x1E, 0xEF, 0x1D, 0xF1, 0xCF, 0x3A, 0x5A, 0x59,
+    0x5A, 0x58, 0x5C, 0x57, 0x4E, 0x47, 0x4E, 0x47, 0x4E, 0x47, 0x4E, 0x47, 0x5C, 0x58, 0x5A, 0x59,
+    0x5A, 0x5A, 0xF3, 0xCF, 0x1D, 0xF1, 0xEE, 0xF1, 0xCF, 0x3A, 0xF4, 0xAF, 0x66, 0xFF, 0xA0,
+};
+
+static const uint8_t icon_theme_data_30[51] = { // 30x30, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xD5, 0xF8, 0x9F, 0x5B, 0xF3, 0xDF, 0x1F, 0x0E, 0xF2, 0xDF, 0x2C, 0xF4, 0xB6, 0x76,
+    0xA6, 0x96, 0x95, 0xB5, 0x85, 0xD5, 0x74, 0xF0, 0x47, 0x4F, 0x04, 0x74, 0xF0, 0x47, 0x5D, 0x58,
+    0x5B, 0x59, 0x69, 0x6A, 0x67, 0x6B, 0xF4, 0xCF, 0x2D, 0xF2, 0xEF, 0x0F, 0x1D, 0xF3, 0xBF, 0x59,
+    0xF8, 0x5F, 0xFC,
+};
+
+static const uint8_t icon_theme_data_31[54] = { // 31x31, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xF0, 0x6F, 0x8A, 0xF5, 0xCF, 0x3E, 0xF1, 0xF1, 0xEF, 0x3D, 0xF3, 0xCF, 0x5B, 0x68,
+    0x6A, 0x6A, 0x69, 0x5C, 0x58, 0x5E, 0x57, 0x4F, 0x14, 0x74, 0xF1, 0x47, 0x4F, 0x14, 0x74, 0xF1,
+    0x47, 0x5E, 0x58, 0x5C, 0x59, 0x6A, 0x6A, 0x68, 0x6B, 0xF5, 0xCF, 0x3D, 0xF3, 0xEF, 0x1F, 0x1E,
+    0xF3, 0xCF, 0x5A, 0xF8, 0x6F, 0xFD,
+};
+
+static const uint8_t icon_theme_data_32[57] = { // 32x32, stride 4, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xF2, 0x6F, 0x9A, 0xF6, 0xCF, 0x4E, 0xF2, 0xF1, 0xF0, 0xF3, 0xEF, 0x3D, 0xF5, 0xC6,
+    0x86, 0xB6, 0xA6, 0xA5, 0xC5, 0x95, 0xE5, 0x84, 0xF1, 0x48, 0x4F, 0x14, 0x84, 0xF1, 0x48, 0x4F,
+    0x14, 0x85, 0xE5, 0x95, 0xC5, 0xA6, 0xA6, 0xB6, 0x86, 0xCF, 0x5D, 0xF3, 0xEF, 0x3F, 0x0F, 0x1F,
+    0x2E, 0xF4, 0xCF, 0x6A, 0xF9, 0x6F, 0xFF, 0xFF, 0x20,
+};
+
+static const uint8_t icon_theme_data_33[59] = { // 33x33, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xF8, 0x6F, 0xAA, 0xF7, 0xCF, 0x5E, 0xF3, 0xF1, 0xF1, 0xF3, 0xF0, 0xF3, 0xEF,
+    0x5D, 0x68, 0x6C, 0x6A, 0x6B, 0x5C, 0x5A, 0x5E, 0x59, 0x4F, 0x14, 0x94, 0xF1, 0x49, 0x4F, 0x14,
+    0x94, 0xF1, 0x49, 0x5E, 0x5A, 0x5C, 0x5B, 0x6A, 0x6C, 0x68, 0x6D, 0xF5, 0xEF, 0x3F, 0x0F, 0x3F,
+    0x1F, 0x1F, 0x3E, 0xF5, 0xCF, 0x7A, 0xFA, 0x6F, 0xFF, 0xFF, 0x40,
+};
+
+static const uint8_t icon_theme_data_34[63] = { // 34x34, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFB, 0x7F, 0xAB, 0xF7, 0xDF, 0x5F, 0x0F, 0x3F, 0x2F, 0x1F, 0x4F, 0x0F, 0x4E,
+    0xF6, 0xD6, 0x96, 0xC6, 0xB6, 0xB5, 0xD5, 0xA5, 0xF0, 0x59, 0x4F, 0x24, 0x94, 0xF2, 0x49, 0x4F,
+    0x24, 0x94, 0xF2, 0x49, 0x4F, 0x24, 0x95, 0xF0, 0x5A, 0x5D, 0x5B, 0x6B, 0x6C, 0x69, 0x6D, 0xF6,
+    0xEF, 0x4F, 0x0F, 0x4F, 0x1F, 0x2F, 0x3F, 0x0F, 0x5D, 0xF7, 0xBF, 0xA7, 0xFF, 0xFF, 0xF6,
+};
+
+static const uint8_t icon_theme_data_35[65] = { // 35x35, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFC, 0xAF, 0x8E, 0xF5, 0xF1, 0xF3, 0xF3, 0xF1, 0xF5, 0xF0, 0xF5,
+    0xEF, 0x7D, 0x78, 0x7D, 0x78, 0x7C, 0x7A, 0x7B, 0x5E, 0x5A, 0x5F, 0x15, 0x94, 0xF3, 0x49, 0x4F,
+    0x34, 0x94, 0xF3, 0x49, 0x4F, 0x34, 0x95, 0xF1, 0x5A, 0x5E, 0x5B, 0x7A, 0x7C, 0x78, 0x7D, 0x78,
+    0x7D, 0xF7, 0xEF, 0x5F, 0x0F, 0x5F, 0x1F, 0x3F, 0x3F, 0x1F, 0x5E, 0xF8, 0xAF, 0xC6, 0xFF, 0xFF,
+    0xF9,
+};
+
+static const uint8_t icon_theme_data_36[68] = { // 36x36, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0xFC, 0xBF, 0x9D, 0xF7, 0xF0, 0xF4, 0xF3, 0xF2, 0xF6, 0xF0, 0xF6,
+    0xF0, 0xF6, 0xEF, 0x8D, 0x79, 0x7C, 0x7B, 0x7B, 0x6D, 0x6A, 0x6F, 0x06, 0x94, 0xF3, 0x59, 0x4F,
+    0x35, 0x94, 0xF3, 0x59, 0x4F, 0x35, 0x94, 0xF3, 0x59, 0x6F, 0x06, 0xA6, 0xD6, 0xB7, 0xB7, 0xC7,
+    0x97, 0xDF, 0x8E, 0xF6, 0xF0, 0xF6, 0xF0, 0xF6, 0xF1, 0xF3, 0xF5, 0xF0, 0xF7, 0xDF, 0x9B, 0xFC,
+    0x7F, 0xFF, 0xFF, 0xB0,
+};
+
+static const uint8_t icon_theme_data_37[70] = { // 37x37, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0xFD, 0xCF, 0x9E, 0xF7, 0xF1, 0xF5, 0xF3, 0xF4, 0xF3, 0xF3, 0xF5,
+    0xF2, 0xF5, 0xF0, 0xF9, 0xD7, 0xA7, 0xC7, 0xC7, 0xB6, 0xE6, 0xB6, 0xE6, 0xA6, 0xF1, 0x69, 0x5F,
+    0x35, 0x95, 0xF3, 0x59, 0x5F, 0x35, 0x95, 0xF3, 0x59, 0x6F, 0x16, 0xA6, 0xE6, 0xB6, 0xE6, 0xB7,
+    0xC7, 0xC7, 0xA7, 0xDF, 0x9F, 0x0F, 0x5F, 0x2F, 0x5F, 0x3F, 0x3F, 0x4F, 0x3F, 0x5F, 0x1F, 0x7E,
+    0xF9, 0xCF, 0xD6, 0xFF, 0xFF, 0xFE,
+};
+
+static const uint8_t icon_theme_data_38[77] = { // 38x38, stride 5, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0xFE, 0xBF, 0xAF, 0x0F, 0x7F, 0x2F, 0x6F, 0x2F, 0x5F, 0x4F, 0x3F,
+    0x6F, 0x2F, 0x6F, 0x1F, 0x8F, 0x07, 0x97, 0xF0, 0x79, 0x7D, 0x8B, 0x8B, 0x6F, 0x06, 0xA6, 0xF2,
+    0x69, 0x5F, 0x45, 0x95, 0xF4, 0x59, 0x5F, 0x45, 0x95, 0xF4, 0x59, 0x5F, 0x45, 0x96, 0xF2, 0x6A,
+    0x6F, 0x06, 0xB8, 0xB8, 0xD7, 0x97, 0xF0, 0x79, 0x7F, 0x0F, 0x8F, 0x1F, 0x6F, 0x2F, 0x6F, 0x3F,
+    0x4F, 0x5F, 0x2F, 0x6F, 0x2F, 0x7F, 0x0F, 0xAB, 0xFE, 0x7F, 0xFF, 0xFF, 0xF1,
+};
+
+static const MLCD_Bitmap_t icon_theme_scaled[14] = {
+    {icon_theme_data_25, 25, 25, 4, MLCD_ENC_RLE},
+    {icon_theme_data_26, 26, 26, 4, MLCD_ENC_RLE},
+    {icon_theme_data_27, 27, 27, 4, MLCD_ENC_RLE},
+    {icon_theme_data_28, 28, 28, 4, MLCD_ENC_RLE},
+    {icon_theme_data_29, 29, 29, 4, MLCD_ENC_RLE},
+    {icon_theme_data_30, 30, 30, 4, MLCD_ENC_RLE},
+    {icon_theme_data_31, 31, 31, 4, MLCD_ENC_RLE},
+    {icon_theme_data_32, 32, 32, 4, MLCD_ENC_RLE},
+    {icon_theme_data_33, 33, 33, 5, MLCD_ENC_RLE},
+    {icon_theme_data_34, 34, 34, 5, MLCD_ENC_RLE},
+    {icon_theme_data_35, 35, 35, 5, MLCD_ENC_RLE},
+    {icon_theme_data_36, 36, 36, 5, MLCD_ENC_RLE},
+    {icon_theme_data_37, 37, 37, 5, MLCD_ENC_RLE},
+    {icon_theme_data_38, 38, 38, 5, MLCD_ENC_RLE},
+};
+
+const MLCD_Asset_t icon_theme = {
+    .base = {icon_theme_data, 32, 32, 4, MLCD_ENC_RLE},
+    .scaled = icon_theme_scaled,
+    .scaled_count = 14,
+};
+
+static const uint8_t image_splash_data[917] = { // 128x128, stride 16, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF, 0x9F, 0xFF, 0xFF, 0xFF, 0x2F, 0x54, 0xFF, 0xFF, 0xFF, 0xB4,
+    0xF3, 0x3F, 0xFF, 0xFF, 0xFF, 0x13, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xE2, 0xFF, 0xFF, 0xFF,
+    0xF6, 0x2C, 0x3F, 0xFF, 0xFF, 0xFF, 0x72, 0xB2, 0xFF, 0xFF, 0xFF, 0xF8, 0x2B, 0x2F, 0xFF, 0xFF,
+    0xFF, 0x92, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF,
+    0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F,
+    0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92,
+    0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29,
+    0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2,
+    0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xD2, 0xF5, 0x27, 0x2F, 0x86, 0xAA, 0xF5, 0x29, 0x2C,
+    0x4F, 0x34, 0x54, 0xF4, 0xB7, 0xF0, 0xF1, 0x29, 0x2C, 0x5F, 0x15, 0x54, 0xF2, 0xF0, 0x5F, 0x2E,
+    0x29, 0x2C, 0x5F, 0x15, 0x54, 0xF1, 0x66, 0x54, 0x48, 0x6D, 0x29, 0x2C, 0x6E, 0x65, 0x4F, 0x05,
+    0xA2, 0x54, 0xA5, 0xC2, 0x92, 0xC6, 0xD7, 0x54, 0xE4, 0xF4, 0x4B, 0x4C, 0x29, 0x2C, 0x31, 0x3C,
+    0x31, 0x35, 0x4E, 0x4F, 0x44, 0xC4, 0xB2, 0x92, 0xC3, 0x13, 0xB3, 0x23, 0x54, 0xD4, 0xF5, 0x4D,
+    0x3B, 0x29, 0x2C, 0x32, 0x3A, 0x32, 0x35, 0x4D, 0x4F, 0x54, 0xD4, 0xA2, 0x92, 0xC3, 0x24, 0x83,
+    0x33, 0x54, 0xD3, 0xF6, 0x4E, 0x3A, 0x29, 0x2C, 0x33, 0x38, 0x33, 0x35, 0x4D, 0x3F, 0x64, 0xE3,
+    0xA2, 0x92, 0xC3, 0x43, 0x63, 0x43, 0x54, 0xD3, 0xF6, 0x4E, 0x3A, 0x29, 0x2C, 0x34, 0x36, 0x34,
+    0x35, 0x4D, 0x3F, 0x64, 0xE3, 0xA2, 0x92, 0xC3, 0x53, 0x43, 0x53, 0x54, 0xD3, 0xF6, 0x4E, 0x3A,
+    0x29, 0x2C, 0x35, 0x34, 0x35, 0x35, 0x4D, 0x3F, 0x64, 0xE3, 0xA2, 0x92, 0xC3, 0x63, 0x23, 0x63,
+    0x54, 0xD3, 0xF6, 0x4E, 0x3A, 0x29, 0x2C, 0x36, 0x31, 0x46, 0x35, 0x4D, 0x4F, 0x54, 0xD4, 0xA2,
+    0x92, 0xC3, 0x76, 0x73, 0x54, 0xD4, 0xF5, 0x4D, 0x3B, 0x29, 0x2C, 0x37, 0x58, 0x35, 0x4E, 0x3F,
+    0x54, 0xC4, 0xB2, 0x92, 0xC3, 0x84, 0x83, 0x54, 0xE4, 0xF4, 0x4C, 0x3C, 0x29, 0x2C, 0x39, 0x29,
+    0x35, 0x4F, 0x04, 0xB2, 0x54, 0xB4, 0xC2, 0x92, 0xC3, 0xF5, 0x35, 0x4F, 0x15, 0x75, 0x44, 0x95,
+    0xD2, 0x92, 0xC3, 0xF5, 0x35, 0xE7, 0xF0, 0x5F, 0x2E, 0x29, 0x2C, 0x3F, 0x53, 0x5E, 0x8C, 0x7F,
+    0x0F, 0x12, 0x92, 0xC3, 0xF5, 0x27, 0xDA, 0x89, 0xCF, 0x42, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29,
+    0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2,
+    0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA,
+    0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF,
+    0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xF7, 0xFF, 0xFF,
+    0xBF, 0x72, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF,
+    0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xF1, 0x16, 0x1F, 0xF5, 0x16, 0x42,
+    0x57, 0x42, 0x15, 0x12, 0x1F, 0x02, 0x92, 0xF1, 0x24, 0x2F, 0xF5, 0x15, 0x16, 0x14, 0x15, 0x16,
+    0x15, 0x12, 0x1F, 0x02, 0x92, 0xF1, 0x24, 0x23, 0x24, 0x21, 0x24, 0x24, 0x29, 0x15, 0x16, 0x15,
+    0x13, 0x17, 0x15, 0x12, 0x1F, 0x02, 0x92, 0xF1, 0x11, 0x12, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x13, 0x12, 0x14, 0x14, 0x17, 0x15, 0x13, 0x17, 0x15, 0x12, 0x1F, 0x02, 0x92,
+    0xF1, 0x11, 0x12, 0x11, 0x11, 0x22, 0x12, 0x12, 0x12, 0x11, 0x13, 0x12, 0x13, 0x12, 0x14, 0x14,
+    0x17, 0x15, 0x13, 0x14, 0x21, 0x15, 0x12, 0x1F, 0x02, 0x92, 0xF1, 0x12, 0x22, 0x11, 0x25, 0x12,
+    0x12, 0x11, 0x13, 0x12, 0x14, 0x16, 0x14, 0x26, 0x15, 0x13, 0x15, 0x11, 0x24, 0x12, 0x1F, 0x02,
+    0x92, 0xF1, 0x13, 0x12, 0x12, 0x15, 0x12, 0x12, 0x11, 0x13, 0x12, 0x14, 0x25, 0x15, 0x16, 0x14,
+    0x15, 0x14, 0x12, 0x13, 0x13, 0x1F, 0x02, 0x92, 0xF1, 0x16, 0x13, 0x32, 0x12, 0x12, 0x12, 0x33,
+    0x14, 0x25, 0x43, 0x42, 0x57, 0x44, 0x34, 0x1F, 0x02, 0x92, 0xFF, 0xF7, 0x1F, 0xFF, 0xF2, 0x29,
+    0x2F, 0xFF, 0x71, 0xFF, 0xFF, 0x22, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF,
+    0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF,
+    0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF,
+    0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF,
+    0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x29, 0x2F, 0xFF, 0xFF, 0xFF, 0xA2, 0x92, 0xFF, 0xFF, 0xFF, 0xFA, 0x2A, 0x2F,
+    0xFF, 0xFF, 0xFF, 0x92, 0xA2, 0xFF, 0xFF, 0xFF, 0xF8, 0x2B, 0x2F, 0xFF, 0xFF, 0xFF, 0x82, 0xC2,
+    0xFF, 0xFF, 0xFF, 0xF6, 0x2E, 0x2F, 0xFF, 0xFF, 0xFF, 0x43, 0xE3, 0xFF, 0xFF, 0xFF, 0xF2, 0x3F,
+    0x23, 0xFF, 0xFF, 0xFF, 0xD4, 0xF4, 0xFF, 0xFF, 0xFF, 0xF2, 0xF8, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+};
+
+const MLCD_Bitmap_t image_splash = {image_splash_data, 128, 128, 16, MLCD_ENC_RLE};
+
+static const uint8_t sprite_spinner_f0[37] = { // frame 0, 24x24, key, MLCD_ENC_RLE
+    0xFF, 0xFD, 0x4F, 0x27, 0xF1, 0x9F, 0x08, 0x12, 0xC9, 0xE5, 0x91, 0x94, 0xA1, 0x93, 0xF6, 0x2F,
+    0x63, 0xD1, 0x73, 0xD1, 0x81, 0xF9, 0x1F, 0x73, 0xB1, 0x93, 0xB1, 0xD1, 0xF7, 0x26, 0x2F, 0x01,
+    0x22, 0xFF, 0xFF, 0xFF, 0xF2,
+};
+
+static const uint8_t sprite_spinner_mask0_data[33] = { // mask, 24x24, MLCD_ENC_RLE
+    0xB2, 0xF3, 0xAD, 0xD9, 0xF1, 0x7F, 0x36, 0xF4, 0x4F, 0x53, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0xFF,
+    0xFB, 0x1F, 0x81, 0xF7, 0x2F, 0x72, 0xF7, 0x3F, 0x54, 0xF5, 0x5F, 0x37, 0xF1, 0x9E, 0xCA, 0xF2,
+    0x4A,
+};
+
+static const MLCD_Bitmap_t sprite_spinner_mask0 = {sprite_spinner_mask0_data, 24, 24, 3, MLCD_ENC_RLE};
+
+static const uint8_t sprite_spinner_f1[33] = { // frame 1, 24x24, key, MLCD_ENC_RLE
+    0xFF, 0xFE, 0x2F, 0x67, 0xDC, 0xCC, 0xC4, 0x17, 0xA5, 0x53, 0x11, 0x93, 0xB1, 0x93, 0xFF, 0xE3,
+    0xD1, 0x73, 0xD1, 0xFF, 0xFB, 0x3B, 0x1A, 0x1C, 0x1F, 0xF6, 0x26, 0x2F, 0x32, 0xFF, 0xFF, 0xFF,
+    0xF2,
+};
+
+static const uint8_t sprite_spinner_f2[35] = { // frame 2, 24x24, key, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xF7, 0x41, 0x2E, 0xBD, 0xBD, 0x31, 0x21, 0x68, 0x38, 0x67, 0x39, 0x58, 0x1A, 0x5F,
+    0x53, 0x81, 0xE1, 0x81, 0xE1, 0xFF, 0xFC, 0x1C, 0x1A, 0x1C, 0x1F, 0xF6, 0x26, 0x2F, 0x32, 0xFF,
+    0xFF, 0xFF, 0xF2,
+};
+
+static const uint8_t sprite_spinner_f3[34] = { // frame 3, 24x24, delta, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xF7, 0x12, 0x11, 0x2F, 0x11, 0xF9, 0x1F, 0x71, 0x12, 0xF0, 0x11, 0x1F, 0xFF, 0x11,
+    0xA1, 0xFC, 0x2F, 0x42, 0x12, 0xF4, 0x21, 0x2F, 0x45, 0xF6, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFA,
+};
+
+static const uint8_t sprite_spinner_f4[39] = { // frame 4, 24x24, delta, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xD1, 0x21, 0x21, 0x31, 0xF0, 0x13, 0x13, 0x1D, 0x1B, 0x1F, 0x42, 0x31, 0x71,
+    0x11, 0xD1, 0xF8, 0x1F, 0x51, 0x31, 0xFF, 0xFF, 0xB1, 0xF3, 0x31, 0x1F, 0x42, 0x12, 0xF4, 0x21,
+    0x2F, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+};
+
+static const uint8_t sprite_spinner_f5[34] = { // frame 5, 24x24, delta, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xF8, 0x2F, 0x41, 0x51, 0xF5, 0x2F, 0x41, 0x51, 0x22, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC,
+    0x1F, 0x81, 0xF8, 0x1F, 0x71, 0x31, 0xFF, 0xB2, 0xF6, 0x4F, 0x52, 0x21, 0xF4, 0x5F, 0x53, 0xFF,
+    0xFF, 0xF4,
+};
+
+static const uint8_t sprite_spinner_f6[33] = { // frame 6, 24x24, delta, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xF7, 0x1F, 0x61, 0xFA, 0x1F, 0xFF, 0xFC, 0x11, 0x1F, 0x71, 0x11, 0xF9, 0x1F,
+    0x81, 0xF7, 0x1F, 0xFF, 0x21, 0xF2, 0x15, 0x1D, 0x36, 0x1E, 0x3F, 0x52, 0xF8, 0x4F, 0x54, 0xFF,
+    0xFD,
+};
+
+static const uint8_t sprite_spinner_f7[33] = { // frame 7, 24x24, key, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xF2, 0x2F, 0x32, 0x62, 0xFF, 0x61, 0xC1, 0xA1, 0xB3, 0xFF, 0xFB, 0x1D, 0x37,
+    0x1D, 0x3F, 0xFE, 0x39, 0x1B, 0x39, 0x11, 0x35, 0x5A, 0x71, 0x4C, 0xCC, 0xCD, 0x7F, 0x62, 0xFF,
+    0xFE,
+};
+
+static const uint8_t sprite_spinner_f8[35] = { // frame 8, 24x24, key, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xF2, 0x2F, 0x32, 0x62, 0xFF, 0x61, 0xC1, 0xA1, 0xC1, 0xFF, 0xFC, 0x1E, 0x18,
+    0x1E, 0x18, 0x3F, 0x55, 0xA1, 0x85, 0x93, 0x76, 0x83, 0x86, 0x43, 0xDB, 0xDB, 0xE2, 0x14, 0xF6,
+    0x2F, 0xFF, 0xE0,
+};
+
+static const uint8_t sprite_spinner_f9[35] = { // frame 9, 24x24, delta, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0xF6, 0x5F, 0x42, 0x12, 0xF4, 0x21, 0x2F, 0x42,
+    0xFC, 0x1A, 0x1F, 0xFF, 0x11, 0x11, 0xF3, 0x1F, 0x71, 0xF1, 0x17, 0x1F, 0x12, 0x11, 0x21, 0xF6,
+    0x2F, 0xFF, 0xE0,
+};
+
+static const uint8_t sprite_spinner_f10[38] = { // frame 10, 24x24, delta, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0x52, 0x12, 0xF4, 0x21, 0x2F, 0x41, 0x13, 0xF3, 0x1F, 0xFF,
+    0xFB, 0x13, 0x1F, 0x51, 0xF8, 0x1D, 0x11, 0x17, 0x14, 0x1F, 0xF1, 0x1D, 0x13, 0x13, 0x1F, 0x41,
+    0x21, 0x21, 0xFF, 0xFF, 0xFF, 0xD0,
+};
+
+static const uint8_t sprite_spinner_f11[35] = { // frame 11, 24x24, delta, MLCD_ENC_RLE
+    0xFF, 0xFF, 0xF4, 0x3F, 0x55, 0xF4, 0x12, 0x2F, 0x54, 0xF6, 0x2F, 0xFB, 0x13, 0x1F, 0x71, 0xF4,
+    0x1F, 0x81, 0xFF, 0xFF, 0xF1, 0x1F, 0x81, 0xF5, 0x32, 0x15, 0x1F, 0x42, 0xF5, 0x15, 0x1F, 0x42,
+    0xFF, 0xFF, 0xF8,
+};
+
+static const MLCD_Frame_t sprite_spinner_frames[12] = {
+    {{sprite_spinner_f0, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, 0},
+    {{sprite_spinner_f1, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, 0},
+    {{sprite_spinner_f2, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, 0},
+    {{sprite_spinner_f3, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, MLCD_FRAME_DELTA},
+    {{sprite_spinner_f4, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, MLCD_FRAME_DELTA},
+    {{sprite_spinner_f5, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, MLCD_FRAME_DELTA},
+    {{sprite_spinner_f6, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, MLCD_FRAME_DELTA},
+    {{sprite_spinner_f7, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, 0},
+    {{sprite_spinner_f8, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, 0},
+    {{sprite_spinner_f9, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, MLCD_FRAME_DELTA},
+    {{sprite_spinner_f10, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, MLCD_FRAME_DELTA},
+    {{sprite_spinner_f11, 24, 24, 3, MLCD_ENC_RLE}, &sprite_spinner_mask0, MLCD_FRAME_DELTA},
+};
+
+const MLCD_Sprite_t sprite_spinner = {
+    .frames = sprite_spinner_frames,
+    .frame_count = 12,
+    .frame_ms = 60,
+    .w = 24, .h = 24, .stride = 3,
+    .has_delta = 1,
+};
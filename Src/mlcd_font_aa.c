@@ -0,0 +1,652 @@
+//
+// Generated by tools/fontgen.py - do not edit.
+// Source: Lato-Regular.ttf, sizes: 12 16, 4x oversampled, 4-bit coverage.
+//
+
+#include "mlcd_font_aa.h"
+
+static const uint8_t mlcd_font_aa12_bitmap[2561] = {
+    0x75, 0x97, 0x97, 0x97, 0x86, 0x75, 0x00, 0x43, 0xA8, 0x91, 0x91, 0xD1, 0xD1, 0xC1, 0xC1, 0x20,
+    0x20, 0x00, 0x55, 0x81, 0x00, 0x00, 0x4A, 0x94, 0x00, 0x41, 0x5D, 0x99, 0x02, 0x83, 0x8E, 0x9D,
+    0x04, 0x30, 0x0B, 0x1C, 0x00, 0x72, 0x4A, 0x4E, 0x01, 0xC5, 0x9A, 0x8D, 0x01, 0xB0, 0x53, 0x08,
+    0x00, 0xD0, 0x80, 0x05, 0x00, 0x00, 0x50, 0x05, 0x00, 0x10, 0xD8, 0x4B, 0x00, 0xA0, 0x99, 0xA6,
+    0x00, 0xE0, 0x81, 0x02, 0x00, 0xC0, 0xA9, 0x01, 0x00, 0x20, 0xFA, 0x4B, 0x00, 0x00, 0xA0, 0xE6,
+    0x02, 0x00, 0xA0, 0xA0, 0x05, 0x82, 0xA1, 0xD2, 0x02, 0x80, 0xED, 0x5D, 0x00, 0x00, 0xA1, 0x00,
+    0x00, 0x00, 0x41, 0x00, 0x00, 0x80, 0x5B, 0x00, 0x90, 0x02, 0x86, 0xC1, 0x01, 0x78, 0x00, 0x48,
+    0x90, 0x43, 0x0B, 0x00, 0xA4, 0xC5, 0xC2, 0x02, 0x00, 0x40, 0x27, 0x5B, 0x32, 0x00, 0x00, 0x70,
+    0x68, 0xAB, 0x08, 0x00, 0xC3, 0xB0, 0x01, 0x0D, 0x10, 0x2C, 0xB0, 0x02, 0x0C, 0x90, 0x05, 0x30,
+    0xCC, 0x05, 0x00, 0xA4, 0x3A, 0x00, 0x00, 0x20, 0x2D, 0xD3, 0x01, 0x00, 0x50, 0x0A, 0x10, 0x00,
+    0x00, 0x10, 0x2E, 0x00, 0x00, 0x00, 0x50, 0xDD, 0x02, 0x33, 0x00, 0xD3, 0x61, 0x2D, 0x49, 0x00,
+    0x97, 0x00, 0xD6, 0x1D, 0x00, 0xC5, 0x01, 0xD1, 0x1D, 0x00, 0x70, 0xBC, 0x4B, 0xC7, 0x01, 0x91,
+    0xD1, 0xC1, 0x20, 0x00, 0x02, 0x10, 0x0D, 0x70, 0x07, 0xC0, 0x02, 0xD1, 0x00, 0xC2, 0x00, 0xB3,
+    0x00, 0xC2, 0x00, 0xE0, 0x01, 0xA0, 0x05, 0x40, 0x0B, 0x00, 0x07, 0x11, 0x00, 0x86, 0x00, 0xD1,
+    0x01, 0x90, 0x05, 0x60, 0x09, 0x40, 0x0A, 0x30, 0x0B, 0x50, 0x0A, 0x70, 0x07, 0xC0, 0x03, 0xC3,
+    0x00, 0x34, 0x00, 0x00, 0x02, 0x00, 0x22, 0x38, 0x01, 0x81, 0x6D, 0x00, 0x83, 0x9A, 0x01, 0x00,
+    0x06, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x83, 0xE8, 0x88, 0x03, 0x41, 0xE4,
+    0x44, 0x01, 0x00, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x62, 0xF5, 0x90, 0x23, 0xB4, 0x6B,
+    0x62, 0xD5, 0x00, 0x70, 0x05, 0x00, 0xC0, 0x00, 0x00, 0x84, 0x00, 0x00, 0x3A, 0x00, 0x20, 0x0B,
+    0x00, 0x70, 0x06, 0x00, 0xC0, 0x01, 0x00, 0x94, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x06, 0x00, 0x00,
+    0x10, 0xB9, 0x18, 0x00, 0xC0, 0x06, 0xC6, 0x00, 0xB5, 0x00, 0xC0, 0x04, 0x88, 0x00, 0x90, 0x08,
+    0x7A, 0x00, 0x80, 0x09, 0x89, 0x00, 0x80, 0x08, 0xA6, 0x00, 0xB0, 0x05, 0xE1, 0x03, 0xD3, 0x01,
+    0x30, 0xCC, 0x3C, 0x00, 0x00, 0x77, 0x00, 0x90, 0xAE, 0x00, 0xA8, 0xA7, 0x00, 0x01, 0xA6, 0x00,
+    0x00, 0xA6, 0x00, 0x00, 0xA6, 0x00, 0x00, 0xA6, 0x00, 0x00, 0xA6, 0x00, 0xB3, 0xED, 0x4B, 0x10,
+    0xB8, 0x29, 0x00, 0xC0, 0x06, 0xD5, 0x00, 0x91, 0x00, 0xE0, 0x02, 0x00, 0x00, 0xF2, 0x01, 0x00,
+    0x00, 0x9B, 0x00, 0x00, 0x90, 0x1C, 0x00, 0x00, 0xC9, 0x01, 0x00, 0x80, 0x1D, 0x00, 0x00, 0xF5,
+    0xBC, 0xBB, 0x04, 0x10, 0xB8, 0x3A, 0x00, 0xB0, 0x07, 0xE4, 0x01, 0x80, 0x00, 0xD0, 0x03, 0x00,
+    0x00, 0xC5, 0x00, 0x00, 0xA0, 0x6E, 0x00, 0x00, 0x00, 0xD1, 0x04, 0x51, 0x00, 0xA0, 0x06, 0xE1,
+    0x02, 0xE2, 0x02, 0x40, 0xBC, 0x5C, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x70, 0x6E, 0x00, 0x00,
+    0xC4, 0x68, 0x00, 0x10, 0x3D, 0x68, 0x00, 0xA0, 0x07, 0x68, 0x00, 0xB7, 0x00, 0x68, 0x00, 0xB7,
+    0xBB, 0xDD, 0x08, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x30, 0xBB, 0x9B, 0x00, 0x60,
+    0x07, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0xB0, 0x78, 0x05, 0x00, 0x60, 0x45, 0x9B, 0x00, 0x00,
+    0x00, 0xF1, 0x01, 0x00, 0x00, 0xF0, 0x01, 0x40, 0x00, 0xB6, 0x00, 0xB2, 0xBC, 0x1A, 0x00, 0x00,
+    0x20, 0x1A, 0x00, 0x00, 0xC1, 0x06, 0x00, 0x00, 0x99, 0x00, 0x00, 0x50, 0x7D, 0x16, 0x00, 0xE0,
+    0x49, 0xD8, 0x01, 0xC4, 0x00, 0xB0, 0x05, 0xB5, 0x00, 0xA0, 0x06, 0xD1, 0x02, 0xD2, 0x02, 0x40,
+    0xBC, 0x4C, 0x00, 0xB4, 0xBB, 0xBB, 0x06, 0x00, 0x00, 0xD0, 0x04, 0x00, 0x00, 0xC6, 0x00, 0x00,
+    0x00, 0x4D, 0x00, 0x00, 0x50, 0x0C, 0x00, 0x00, 0xD0, 0x05, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x50, 0x0C, 0x00, 0x00, 0x20, 0xB9, 0x18, 0x00, 0xD0, 0x05, 0xC6, 0x00, 0xE2,
+    0x00, 0xF0, 0x01, 0xC0, 0x05, 0xB6, 0x00, 0x50, 0xCE, 0x4E, 0x00, 0xE3, 0x01, 0xE2, 0x02, 0xB6,
+    0x00, 0xB0, 0x05, 0xE3, 0x01, 0xE2, 0x02, 0x60, 0xBC, 0x5C, 0x00, 0x00, 0xB7, 0x3A, 0x00, 0xA0,
+    0x18, 0xD3, 0x01, 0xF1, 0x00, 0x90, 0x06, 0xF1, 0x01, 0xA0, 0x06, 0xA0, 0x4A, 0xF7, 0x02, 0x00,
+    0x75, 0x9A, 0x00, 0x00, 0x40, 0x1D, 0x00, 0x00, 0xD1, 0x04, 0x00, 0x00, 0x8B, 0x00, 0x00, 0xE2,
+    0x02, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0xE2, 0x02, 0xE2, 0x02, 0x70, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x00, 0xE2, 0x03, 0x80, 0x01, 0x41, 0x00, 0x00, 0x20, 0x04, 0x20, 0xC9,
+    0x03, 0xC9, 0x05, 0x00, 0xC8, 0x06, 0x00, 0x10, 0xD8, 0x04, 0x00, 0x10, 0x04, 0x81, 0x88, 0x88,
+    0x40, 0x44, 0x44, 0x81, 0x88, 0x88, 0x40, 0x44, 0x44, 0x24, 0x00, 0x00, 0xC4, 0x29, 0x00, 0x00,
+    0xC5, 0x08, 0x00, 0xC6, 0x07, 0xD4, 0x18, 0x00, 0x14, 0x00, 0x00, 0x93, 0x7B, 0x00, 0x35, 0xB1,
+    0x06, 0x00, 0x80, 0x08, 0x00, 0xD4, 0x02, 0x30, 0x2D, 0x00, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x05, 0x00, 0x70, 0x0B, 0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0xC5, 0x89, 0x9B, 0x00,
+    0x60, 0x09, 0x00, 0x40, 0x0A, 0xC1, 0x00, 0xB6, 0x1A, 0x2A, 0x75, 0x90, 0x18, 0x0C, 0x56, 0x57,
+    0xC1, 0x20, 0x0A, 0x57, 0x66, 0xB2, 0x70, 0x08, 0x1B, 0xA2, 0xB0, 0x7B, 0xBC, 0x05, 0xA0, 0x05,
+    0x00, 0x00, 0x00, 0x10, 0xAA, 0x45, 0x95, 0x07, 0x00, 0x20, 0x76, 0x26, 0x00, 0x00, 0x70, 0x09,
+    0x00, 0x00, 0xE1, 0x3E, 0x00, 0x00, 0xB6, 0x88, 0x00, 0x00, 0x5C, 0xE2, 0x00, 0x30, 0x0E, 0xC0,
+    0x05, 0x90, 0x4B, 0x94, 0x0B, 0xE0, 0x88, 0x88, 0x2E, 0xC5, 0x00, 0x00, 0x89, 0x6B, 0x00, 0x00,
+    0xD4, 0xBB, 0xAB, 0x07, 0x00, 0x3E, 0x10, 0x8B, 0x00, 0x3E, 0x00, 0xC6, 0x00, 0x3E, 0x00, 0x89,
+    0x00, 0xCE, 0xDB, 0x1C, 0x00, 0x3E, 0x10, 0xC8, 0x00, 0x3E, 0x00, 0xF1, 0x01, 0x3E, 0x00, 0xD5,
+    0x00, 0xCE, 0xCB, 0x3B, 0x00, 0x00, 0x82, 0xBB, 0x18, 0x40, 0x5D, 0x11, 0x67, 0xE1, 0x04, 0x00,
+    0x00, 0xD5, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0xF2, 0x02, 0x00,
+    0x00, 0x80, 0x1C, 0x00, 0x54, 0x00, 0xC7, 0xCB, 0x2A, 0xBB, 0xBB, 0x39, 0x00, 0x3E, 0x00, 0xD4,
+    0x05, 0x3E, 0x00, 0x30, 0x1E, 0x3E, 0x00, 0x00, 0x6C, 0x3E, 0x00, 0x00, 0x7B, 0x3E, 0x00, 0x00,
+    0x6C, 0x3E, 0x00, 0x10, 0x2F, 0x3E, 0x00, 0xB1, 0x08, 0xCE, 0xBB, 0x6C, 0x00, 0xBB, 0xBB, 0x4B,
+    0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xCE, 0xBB, 0x06, 0x3E, 0x00, 0x00, 0x3E,
+    0x00, 0x00, 0x3E, 0x00, 0x00, 0xCE, 0xBB, 0x4B, 0xBB, 0xBB, 0x4B, 0x3E, 0x00, 0x00, 0x3E, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0x9E, 0x88, 0x06, 0x6E, 0x44, 0x03, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00,
+    0x3E, 0x00, 0x00, 0x00, 0x82, 0xBB, 0x38, 0x00, 0x50, 0x5D, 0x11, 0x95, 0x00, 0xE1, 0x04, 0x00,
+    0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x20, 0x44, 0x00, 0xC6, 0x00, 0x40, 0xF8,
+    0x01, 0xE2, 0x02, 0x00, 0xF0, 0x01, 0x70, 0x2C, 0x00, 0xF1, 0x01, 0x00, 0xC6, 0xCC, 0x8C, 0x00,
+    0x2B, 0x00, 0x20, 0x0B, 0x3E, 0x00, 0x20, 0x0F, 0x3E, 0x00, 0x20, 0x0F, 0x3E, 0x00, 0x20, 0x0F,
+    0xCE, 0xBB, 0xCB, 0x0F, 0x3E, 0x00, 0x20, 0x0F, 0x3E, 0x00, 0x20, 0x0F, 0x3E, 0x00, 0x20, 0x0F,
+    0x3E, 0x00, 0x20, 0x0F, 0x58, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x00, 0xA0, 0x03,
+    0x00, 0xD0, 0x04, 0x00, 0xD0, 0x04, 0x00, 0xD0, 0x04, 0x00, 0xD0, 0x04, 0x00, 0xD0, 0x04, 0x00,
+    0xE0, 0x03, 0x00, 0xE3, 0x01, 0xB7, 0x4C, 0x00, 0x49, 0x00, 0x90, 0x05, 0x5D, 0x00, 0xB8, 0x00,
+    0x5D, 0x60, 0x1D, 0x00, 0x5D, 0xD4, 0x02, 0x00, 0xCD, 0x6E, 0x00, 0x00, 0x5D, 0xE5, 0x02, 0x00,
+    0x5D, 0x70, 0x1D, 0x00, 0x5D, 0x00, 0xB9, 0x00, 0x5D, 0x00, 0xA0, 0x09, 0x2B, 0x00, 0x00, 0x3E,
+    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0xCE, 0xBB, 0x0A, 0x4B, 0x00, 0x00, 0x40, 0x0B, 0xDE, 0x00, 0x00, 0xC0,
+    0x0F, 0xCE, 0x06, 0x00, 0xC6, 0x0F, 0x4E, 0x1E, 0x00, 0x4D, 0x0F, 0x1E, 0x89, 0x70, 0x0A, 0x0F,
+    0x1E, 0xE2, 0xE3, 0x02, 0x0F, 0x1E, 0x80, 0x9E, 0x00, 0x0F, 0x1E, 0x10, 0x1A, 0x00, 0x0F, 0x1E,
+    0x00, 0x00, 0x00, 0x0F, 0x2B, 0x00, 0x00, 0x0B, 0xCE, 0x01, 0x00, 0x0F, 0xCE, 0x09, 0x00, 0x0F,
+    0x3E, 0x6E, 0x00, 0x0F, 0x1E, 0xE4, 0x03, 0x0F, 0x1E, 0x80, 0x1D, 0x0F, 0x1E, 0x00, 0xAB, 0x0F,
+    0x1E, 0x00, 0xD1, 0x0F, 0x1E, 0x00, 0x30, 0x0F, 0x00, 0x82, 0xAB, 0x06, 0x00, 0x40, 0x4D, 0x21,
+    0xC8, 0x01, 0xE1, 0x04, 0x00, 0xA0, 0x08, 0xD5, 0x00, 0x00, 0x40, 0x0D, 0xB7, 0x00, 0x00, 0x30,
+    0x0F, 0xC6, 0x00, 0x00, 0x40, 0x0E, 0xE2, 0x02, 0x00, 0x80, 0x0A, 0x70, 0x1B, 0x00, 0xE4, 0x02,
+    0x00, 0xC6, 0xCB, 0x2A, 0x00, 0xB9, 0xAB, 0x06, 0x5D, 0x20, 0x7C, 0x5D, 0x00, 0xD5, 0x5D, 0x00,
+    0xD5, 0x5D, 0x20, 0x7C, 0xCD, 0xAB, 0x05, 0x5D, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x5D, 0x00, 0x00,
+    0x00, 0x82, 0xAB, 0x06, 0x00, 0x40, 0x4D, 0x21, 0xC8, 0x01, 0xE1, 0x04, 0x00, 0xA0, 0x08, 0xD5,
+    0x00, 0x00, 0x40, 0x0D, 0xB7, 0x00, 0x00, 0x30, 0x0F, 0xC6, 0x00, 0x00, 0x40, 0x0E, 0xE2, 0x02,
+    0x00, 0x80, 0x0B, 0x70, 0x1B, 0x00, 0xE4, 0x03, 0x00, 0xC6, 0xCB, 0x7E, 0x00, 0x00, 0x00, 0x00,
+    0xD3, 0x04, 0x00, 0x00, 0x00, 0x30, 0x1A, 0xB9, 0xAB, 0x06, 0x00, 0x5D, 0x20, 0x7C, 0x00, 0x5D,
+    0x00, 0xB6, 0x00, 0x5D, 0x00, 0x99, 0x00, 0xAD, 0xA8, 0x1B, 0x00, 0x7D, 0xE6, 0x02, 0x00, 0x5D,
+    0x80, 0x0B, 0x00, 0x5D, 0x00, 0x7C, 0x00, 0x5D, 0x00, 0xE3, 0x03, 0x20, 0xB9, 0x39, 0xD1, 0x04,
+    0x55, 0xD4, 0x00, 0x00, 0xF2, 0x39, 0x00, 0x60, 0xFE, 0x2C, 0x00, 0x40, 0xCC, 0x00, 0x00, 0xD3,
+    0x54, 0x00, 0x97, 0xB3, 0xBC, 0x1A, 0xB9, 0xBB, 0xBB, 0x0A, 0x00, 0xF1, 0x02, 0x00, 0x00, 0xF1,
+    0x02, 0x00, 0x00, 0xF1, 0x02, 0x00, 0x00, 0xF1, 0x02, 0x00, 0x00, 0xF1, 0x02, 0x00, 0x00, 0xF1,
+    0x02, 0x00, 0x00, 0xF1, 0x02, 0x00, 0x00, 0xF1, 0x02, 0x00, 0xB0, 0x01, 0x00, 0x94, 0xF1, 0x02,
+    0x00, 0xC5, 0xF1, 0x02, 0x00, 0xC5, 0xF1, 0x02, 0x00, 0xC5, 0xF1, 0x02, 0x00, 0xC5, 0xF0, 0x02,
+    0x00, 0xC5, 0xE0, 0x03, 0x00, 0xA7, 0x70, 0x0B, 0x20, 0x4D, 0x00, 0xC7, 0xCB, 0x05, 0x49, 0x00,
+    0x00, 0xB3, 0xB7, 0x00, 0x00, 0x99, 0xF1, 0x02, 0x10, 0x3E, 0xA0, 0x08, 0x60, 0x0C, 0x40, 0x0E,
+    0xC0, 0x06, 0x00, 0x5D, 0xE3, 0x01, 0x00, 0xB7, 0x98, 0x00, 0x00, 0xE1, 0x3E, 0x00, 0x00, 0xA0,
+    0x0C, 0x00, 0x59, 0x00, 0x50, 0x08, 0x00, 0xB2, 0xB8, 0x00, 0xB0, 0x1F, 0x00, 0xB7, 0xF3, 0x01,
+    0xE1, 0x5B, 0x00, 0x7B, 0xE0, 0x05, 0x96, 0xA6, 0x10, 0x2F, 0x90, 0x09, 0x4B, 0xE1, 0x51, 0x0D,
+    0x50, 0x1D, 0x0E, 0xB0, 0x95, 0x08, 0x10, 0x9E, 0x0A, 0x60, 0xEA, 0x03, 0x00, 0xFA, 0x05, 0x10,
+    0xEE, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x9B, 0x00, 0x96, 0x00, 0x10, 0x3A, 0xE1, 0x05, 0x90, 0x0A,
+    0x50, 0x1E, 0xE4, 0x01, 0x00, 0xAA, 0x5D, 0x00, 0x00, 0xF2, 0x0D, 0x00, 0x00, 0xA9, 0x5D, 0x00,
+    0x40, 0x1E, 0xE5, 0x01, 0xD1, 0x05, 0xA0, 0x0A, 0xA9, 0x00, 0x20, 0x4E, 0x68, 0x00, 0x00, 0x3A,
+    0xE3, 0x01, 0x70, 0x0B, 0x90, 0x09, 0xE1, 0x03, 0x10, 0x3E, 0x99, 0x00, 0x00, 0xC6, 0x1E, 0x00,
+    0x00, 0xD0, 0x07, 0x00, 0x00, 0xC0, 0x05, 0x00, 0x00, 0xC0, 0x05, 0x00, 0x00, 0xC0, 0x05, 0x00,
+    0xB3, 0xBB, 0xBB, 0x0B, 0x00, 0x00, 0xC0, 0x0A, 0x00, 0x00, 0xD8, 0x01, 0x00, 0x30, 0x4F, 0x00,
+    0x00, 0xD1, 0x09, 0x00, 0x00, 0xD8, 0x01, 0x00, 0x40, 0x4F, 0x00, 0x00, 0xD1, 0x08, 0x00, 0x00,
+    0xF7, 0xBC, 0xBB, 0x0B, 0x41, 0x04, 0xD2, 0x07, 0xB2, 0x00, 0xB2, 0x00, 0xB2, 0x00, 0xB2, 0x00,
+    0xB2, 0x00, 0xB2, 0x00, 0xB2, 0x00, 0xB2, 0x00, 0xB2, 0x00, 0xB2, 0x1B, 0x0C, 0x00, 0x00, 0x58,
+    0x00, 0x00, 0xB2, 0x00, 0x00, 0xB0, 0x02, 0x00, 0x50, 0x08, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x58,
+    0x00, 0x00, 0xB2, 0x00, 0x00, 0xB0, 0x02, 0x00, 0x30, 0x03, 0x42, 0x03, 0x93, 0x0B, 0x20, 0x0B,
+    0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0B, 0x20, 0x0B,
+    0xB5, 0x08, 0x10, 0x1B, 0x00, 0x90, 0x7C, 0x00, 0xC2, 0xD1, 0x01, 0x5B, 0x60, 0x09, 0x02, 0x00,
+    0x02, 0xBB, 0xBB, 0x08, 0x95, 0x00, 0xA0, 0x05, 0x00, 0x32, 0x00, 0xC0, 0x99, 0x0C, 0x10, 0x00,
+    0x4C, 0x10, 0x75, 0x5D, 0xD2, 0x47, 0x5C, 0xA6, 0x10, 0x5C, 0xC2, 0x9B, 0x59, 0xF1, 0x00, 0x00,
+    0x00, 0xF1, 0x00, 0x00, 0x00, 0xF1, 0x30, 0x02, 0x00, 0xF1, 0x89, 0x8C, 0x00, 0xF1, 0x01, 0xE1,
+    0x01, 0xF1, 0x00, 0xD0, 0x04, 0xF1, 0x00, 0xD0, 0x03, 0xF1, 0x02, 0xD4, 0x00, 0xE1, 0xB9, 0x3C,
+    0x00, 0x00, 0x32, 0x01, 0x90, 0x8B, 0x1C, 0xC4, 0x00, 0x00, 0x98, 0x00, 0x00, 0x97, 0x00, 0x00,
+    0xD3, 0x01, 0x13, 0x60, 0xBC, 0x2A, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xC4, 0x00, 0x32, 0xC4, 0xA0,
+    0x8B, 0xCC, 0xC5, 0x00, 0xC5, 0x88, 0x00, 0xC4, 0x98, 0x00, 0xC4, 0xD5, 0x00, 0xC8, 0x90, 0xBD,
+    0xC7, 0x00, 0x32, 0x00, 0x90, 0x8B, 0x2C, 0xB5, 0x00, 0x95, 0xD8, 0xBB, 0xCC, 0x87, 0x00, 0x00,
+    0xD3, 0x01, 0x21, 0x50, 0xBC, 0x5B, 0x20, 0xAA, 0xB0, 0x06, 0xE3, 0x35, 0xE6, 0x79, 0xD0, 0x03,
+    0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0x00, 0x33, 0x00, 0xC1, 0xA9, 0xAE, 0xA5, 0x00,
+    0x2C, 0xC3, 0x21, 0x1D, 0xB0, 0xAB, 0x04, 0xD2, 0x44, 0x03, 0xA3, 0x87, 0x9C, 0x5A, 0x00, 0xB4,
+    0xC4, 0xAA, 0x2B, 0x00, 0x11, 0x00, 0xE2, 0x00, 0x00, 0xE2, 0x00, 0x00, 0xE2, 0x30, 0x02, 0xF2,
+    0x8A, 0x7C, 0xE2, 0x01, 0xD3, 0xE2, 0x00, 0xE2, 0xE2, 0x00, 0xE2, 0xE2, 0x00, 0xE2, 0xE2, 0x00,
+    0xE2, 0xE2, 0x03, 0x60, 0x01, 0x40, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+    0x01, 0xF0, 0x01, 0x20, 0x3E, 0x00, 0x16, 0x00, 0x04, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+    0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0xB3, 0x0A, 0x10, 0x00, 0xF1, 0x00, 0x00, 0xF1, 0x00,
+    0x00, 0xF1, 0x00, 0x31, 0xF1, 0x10, 0x4C, 0xF1, 0xC1, 0x05, 0xF1, 0x9D, 0x00, 0xF1, 0xD2, 0x03,
+    0xF1, 0x40, 0x1D, 0xF1, 0x00, 0xB7, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x30,
+    0x30, 0x01, 0x32, 0x00, 0xE2, 0x8A, 0x8C, 0xB9, 0x0A, 0xE2, 0x01, 0x99, 0x10, 0x1F, 0xE2, 0x00,
+    0x88, 0x00, 0x2E, 0xE2, 0x00, 0x88, 0x00, 0x2E, 0xE2, 0x00, 0x88, 0x00, 0x2E, 0xE2, 0x00, 0x88,
+    0x00, 0x2E, 0x30, 0x30, 0x02, 0xE2, 0x8A, 0x7C, 0xE2, 0x01, 0xD3, 0xE2, 0x00, 0xE2, 0xE2, 0x00,
+    0xE2, 0xE2, 0x00, 0xE2, 0xE2, 0x00, 0xE2, 0x00, 0x32, 0x01, 0x00, 0x90, 0x8B, 0x5C, 0x00, 0xC5,
+    0x00, 0xE2, 0x00, 0x88, 0x00, 0xE0, 0x03, 0x98, 0x00, 0xE0, 0x02, 0xD3, 0x01, 0xD4, 0x00, 0x60,
+    0xBC, 0x2B, 0x00, 0x30, 0x30, 0x02, 0x00, 0xD2, 0x89, 0x8C, 0x00, 0xF2, 0x01, 0xF1, 0x01, 0xE2,
+    0x00, 0xD0, 0x03, 0xE2, 0x00, 0xE0, 0x03, 0xF2, 0x01, 0xD4, 0x00, 0xF2, 0xBA, 0x3C, 0x00, 0xE2,
+    0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x32, 0x30, 0xA0, 0x8B, 0xCB, 0xC5, 0x00, 0xC5,
+    0x88, 0x00, 0xC4, 0x98, 0x00, 0xC4, 0xD5, 0x00, 0xC8, 0x90, 0xAD, 0xC9, 0x00, 0x00, 0xC4, 0x00,
+    0x00, 0xC4, 0x30, 0x30, 0x02, 0xD2, 0x89, 0x04, 0xF2, 0x02, 0x00, 0xE2, 0x00, 0x00, 0xE2, 0x00,
+    0x00, 0xE2, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x10, 0x23, 0x00, 0xD2, 0xA8, 0x05, 0xA7, 0x00, 0x00,
+    0xD2, 0x6C, 0x00, 0x00, 0xC4, 0x08, 0x11, 0x60, 0x09, 0xC4, 0xBB, 0x02, 0x20, 0x01, 0x00, 0x90,
+    0x04, 0x00, 0xB2, 0x47, 0x00, 0xD5, 0x8A, 0x00, 0xC0, 0x04, 0x00, 0xC0, 0x04, 0x00, 0xC0, 0x04,
+    0x00, 0xB0, 0x05, 0x00, 0x60, 0xBD, 0x01, 0x31, 0x00, 0x31, 0xC4, 0x00, 0xC4, 0xC4, 0x00, 0xC4,
+    0xC4, 0x00, 0xC4, 0xC4, 0x00, 0xC4, 0xE2, 0x01, 0xC7, 0x80, 0xBD, 0xC8, 0x13, 0x00, 0x40, 0x89,
+    0x00, 0xB5, 0xD3, 0x00, 0x5B, 0xC0, 0x24, 0x0E, 0x60, 0x7A, 0x08, 0x10, 0xDE, 0x02, 0x00, 0xB9,
+    0x00, 0x13, 0x00, 0x03, 0x00, 0x03, 0x6A, 0x10, 0x5F, 0x20, 0x0D, 0xA5, 0x60, 0xAB, 0x70, 0x08,
+    0xE1, 0xB0, 0xD3, 0xB0, 0x04, 0xB0, 0xC5, 0xA0, 0xE5, 0x00, 0x60, 0x8D, 0x50, 0x9D, 0x00, 0x20,
+    0x3F, 0x10, 0x5E, 0x00, 0x22, 0x00, 0x32, 0xD4, 0x01, 0x4C, 0x90, 0x89, 0x09, 0x10, 0xDD, 0x01,
+    0x30, 0xDD, 0x04, 0xC0, 0x44, 0x1D, 0x97, 0x00, 0x8A, 0x13, 0x00, 0x40, 0x89, 0x00, 0xB5, 0xE2,
+    0x01, 0x5B, 0xB0, 0x26, 0x0D, 0x40, 0x8C, 0x07, 0x00, 0xED, 0x01, 0x00, 0x98, 0x00, 0x00, 0x3C,
+    0x00, 0x40, 0x0B, 0x00, 0x41, 0x44, 0x04, 0x83, 0xA8, 0x1E, 0x00, 0xC0, 0x05, 0x00, 0xA8, 0x00,
+    0x40, 0x1D, 0x00, 0xD1, 0x03, 0x00, 0xE8, 0xBB, 0x0B, 0x00, 0x03, 0xC0, 0x08, 0xB3, 0x00, 0xC2,
+    0x00, 0xE0, 0x00, 0xC4, 0x00, 0x97, 0x00, 0xE0, 0x00, 0xD1, 0x00, 0xB3, 0x00, 0xD2, 0x01, 0x50,
+    0x1B, 0x25, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x22, 0x00, 0xB3,
+    0x07, 0x20, 0x0C, 0x30, 0x0B, 0x50, 0x08, 0x30, 0x1B, 0x20, 0x3C, 0x60, 0x08, 0x40, 0x0A, 0x20,
+    0x0C, 0x50, 0x0A, 0xA5, 0x02, 0x10, 0x03, 0x60, 0x02, 0xD1, 0xB8, 0xD8, 0x01, 0x42, 0x00, 0x13,
+    0x00,
+};
+
+static const MLCD_Glyph_t mlcd_font_aa12_glyphs[95] = {
+    {    0,  0,  0,   0,   0,  2}, // ' '
+    {    0,  2,  9,   1,   3,  4}, // '!'
+    {    9,  4,  4,   0,   3,  5}, // '"'
+    {   17,  7,  9,   0,   3,  7}, // '#'
+    {   53,  7, 12,   0,   2,  7}, // '$'
+    {  101,  9,  9,   0,   3, 10}, // '%'
+    {  146,  9,  9,   0,   3,  8}, // '&'
+    {  191,  2,  4,   0,   3,  3}, // '''
+    {  195,  3, 12,   0,   2,  4}, // '('
+    {  219,  3, 12,   0,   2,  4}, // ')'
+    {  243,  5,  5,   0,   2,  5}, // 'asterisk'
+    {  258,  7,  6,   0,   5,  7}, // '+'
+    {  282,  2,  4,   0,  10,  2}, // ','
+    {  286,  4,  1,   0,   8,  4}, // '-'
+    {  288,  2,  2,   0,  10,  2}, // '.'
+    {  290,  5, 10,   0,   3,  4}, // 'slash'
+    {  320,  7,  9,   0,   3,  7}, // '0'
+    {  356,  6,  9,   1,   3,  7}, // '1'
+    {  383,  7,  9,   0,   3,  7}, // '2'
+    {  419,  7,  9,   0,   3,  7}, // '3'
+    {  455,  7,  9,   0,   3,  7}, // '4'
+    {  491,  7,  9,   0,   3,  7}, // '5'
+    {  527,  7,  9,   0,   3,  7}, // '6'
+    {  563,  7,  9,   0,   3,  7}, // '7'
+    {  599,  7,  9,   0,   3,  7}, // '8'
+    {  635,  7,  9,   0,   3,  7}, // '9'
+    {  671,  3,  6,   0,   6,  3}, // ':'
+    {  683,  3,  8,   0,   6,  3}, // ';'
+    {  699,  5,  6,   1,   5,  7}, // '<'
+    {  717,  6,  4,   0,   6,  7}, // '='
+    {  729,  5,  6,   1,   5,  7}, // '>'
+    {  747,  5,  9,   0,   3,  5}, // '?'
+    {  774, 10, 11,   0,   3, 10}, // '@'
+    {  829,  8,  9,   0,   3,  8}, // 'A'
+    {  865,  7,  9,   1,   3,  8}, // 'B'
+    {  901,  8,  9,   0,   3,  8}, // 'C'
+    {  937,  8,  9,   1,   3,  9}, // 'D'
+    {  973,  6,  9,   1,   3,  7}, // 'E'
+    { 1000,  6,  9,   1,   3,  7}, // 'F'
+    { 1027,  9,  9,   0,   3,  9}, // 'G'
+    { 1072,  7,  9,   1,   3,  9}, // 'H'
+    { 1108,  2,  9,   1,   3,  4}, // 'I'
+    { 1117,  5,  9,   0,   3,  5}, // 'J'
+    { 1144,  7,  9,   1,   3,  8}, // 'K'
+    { 1180,  5,  9,   1,   3,  6}, // 'L'
+    { 1207,  9,  9,   1,   3, 11}, // 'M'
+    { 1252,  7,  9,   1,   3,  9}, // 'N'
+    { 1288,  9,  9,   0,   3, 10}, // 'O'
+    { 1333,  6,  9,   1,   3,  7}, // 'P'
+    { 1360, 10, 11,   0,   3, 10}, // 'Q'
+    { 1415,  7,  9,   1,   3,  8}, // 'R'
+    { 1451,  6,  9,   0,   3,  6}, // 'S'
+    { 1478,  7,  9,   0,   3,  7}, // 'T'
+    { 1514,  8,  9,   0,   3,  9}, // 'U'
+    { 1550,  8,  9,   0,   3,  8}, // 'V'
+    { 1586, 12,  9,   0,   3, 12}, // 'W'
+    { 1640,  8,  9,   0,   3,  8}, // 'X'
+    { 1676,  8,  9,   0,   3,  8}, // 'Y'
+    { 1712,  7,  9,   0,   3,  8}, // 'Z'
+    { 1748,  4, 12,   0,   2,  4}, // '['
+    { 1772,  5, 10,   0,   3,  4}, // 'backslash'
+    { 1802,  3, 12,   0,   2,  4}, // ']'
+    { 1826,  5,  5,   1,   3,  7}, // '^'
+    { 1841,  5,  1,   0,  13,  5}, // '_'
+    { 1844,  3,  2,   0,   3,  4}, // '`'
+    { 1848,  6,  7,   0,   5,  6}, // 'a'
+    { 1869,  7,  9,   0,   3,  7}, // 'b'
+    { 1905,  6,  7,   0,   5,  6}, // 'c'
+    { 1926,  6,  9,   0,   3,  7}, // 'd'
+    { 1953,  6,  7,   0,   5,  6}, // 'e'
+    { 1974,  4,  9,   0,   3,  4}, // 'f'
+    { 1992,  6, 10,   0,   5,  6}, // 'g'
+    { 2022,  6,  9,   0,   3,  7}, // 'h'
+    { 2049,  3,  9,   0,   3,  3}, // 'i'
+    { 2067,  4, 12,  -1,   3,  3}, // 'j'
+    { 2091,  6,  9,   0,   3,  6}, // 'k'
+    { 2118,  2,  9,   1,   3,  3}, // 'l'
+    { 2127, 10,  7,   0,   5, 10}, // 'm'
+    { 2162,  6,  7,   0,   5,  7}, // 'n'
+    { 2183,  7,  7,   0,   5,  7}, // 'o'
+    { 2211,  7,  9,   0,   5,  7}, // 'p'
+    { 2247,  6,  9,   0,   5,  7}, // 'q'
+    { 2274,  5,  7,   0,   5,  5}, // 'r'
+    { 2295,  5,  7,   0,   5,  5}, // 's'
+    { 2316,  5,  9,   0,   3,  4}, // 't'
+    { 2343,  6,  7,   0,   5,  7}, // 'u'
+    { 2364,  6,  7,   0,   5,  6}, // 'v'
+    { 2385,  9,  7,   0,   5,  9}, // 'w'
+    { 2420,  6,  7,   0,   5,  6}, // 'x'
+    { 2441,  6,  9,   0,   5,  6}, // 'y'
+    { 2468,  6,  7,   0,   5,  6}, // 'z'
+    { 2489,  4, 12,   0,   2,  4}, // '{'
+    { 2513,  2, 12,   1,   2,  4}, // '|'
+    { 2525,  4, 12,   0,   2,  4}, // '}'
+    { 2549,  7,  3,   0,   7,  7}, // '~'
+};
+
+const MLCD_FontDesc_t mlcd_font_aa12 = {
+    .bitmap = mlcd_font_aa12_bitmap,
+    .glyphs = mlcd_font_aa12_glyphs,
+    .first = 0x20,
+    .last = 0x7E,
+    .height = 15,
+};
+
+static const uint8_t mlcd_font_aa16_bitmap[4260] = {
+    0x70, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x06, 0xD0, 0x06, 0xC0, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xC1, 0x06, 0xF2, 0x09, 0x10, 0x00, 0x36, 0x81, 0x01, 0x7C, 0xF2, 0x02,
+    0x7C, 0xF2, 0x02, 0x6B, 0xF1, 0x01, 0x24, 0x60, 0x00, 0x00, 0x30, 0x05, 0x53, 0x00, 0x00, 0xB0,
+    0x07, 0xA8, 0x00, 0x00, 0xD0, 0x04, 0x7B, 0x00, 0x00, 0xF1, 0x01, 0x4E, 0x00, 0xF1, 0xFF, 0xFF,
+    0xFF, 0x0B, 0x00, 0xB7, 0x40, 0x0D, 0x00, 0x00, 0x8A, 0x70, 0x0A, 0x00, 0x84, 0xAE, 0xC8, 0x7B,
+    0x02, 0x84, 0x8F, 0xE8, 0x8A, 0x02, 0x30, 0x0E, 0xF1, 0x02, 0x00, 0x60, 0x0C, 0xE4, 0x00, 0x00,
+    0x90, 0x08, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x20, 0x0B, 0x00, 0x00, 0xA6, 0x6D,
+    0x01, 0xC1, 0xBE, 0xDD, 0x1D, 0xE7, 0x51, 0x08, 0x04, 0xBA, 0x60, 0x07, 0x00, 0xE7, 0x74, 0x06,
+    0x00, 0xC1, 0xEF, 0x19, 0x00, 0x00, 0xD5, 0xFF, 0x08, 0x00, 0xB0, 0x83, 0x4F, 0x00, 0xC0, 0x02,
+    0x7E, 0x03, 0xD0, 0x11, 0x5F, 0xCE, 0xE4, 0xC4, 0x0C, 0xA2, 0xFE, 0xAE, 0x01, 0x00, 0xD1, 0x00,
+    0x00, 0x00, 0xA1, 0x00, 0x00, 0x20, 0x98, 0x03, 0x00, 0x20, 0x07, 0xD1, 0x78, 0x3E, 0x00, 0xC1,
+    0x07, 0xC5, 0x00, 0x89, 0x00, 0xB9, 0x00, 0xB6, 0x00, 0xA7, 0x50, 0x1D, 0x00, 0xE3, 0x01, 0x7B,
+    0xE2, 0x04, 0x00, 0x90, 0xDD, 0x1C, 0x7C, 0x00, 0x00, 0x00, 0x32, 0x90, 0x1B, 0xB8, 0x07, 0x00,
+    0x00, 0xE5, 0xA1, 0x4A, 0x9B, 0x00, 0x20, 0x4E, 0xF0, 0x02, 0xE3, 0x00, 0xC0, 0x08, 0xF1, 0x01,
+    0xE2, 0x00, 0xB8, 0x00, 0xD0, 0x06, 0xB7, 0x50, 0x2E, 0x00, 0x30, 0xED, 0x2D, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x20, 0x98, 0x06, 0x00, 0x00, 0x00, 0xF4, 0x69, 0xAD, 0x00, 0x00, 0x00,
+    0xAB, 0x00, 0xD3, 0x01, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0x1C, 0x00, 0x00, 0x00, 0x40, 0x8E, 0xBD, 0x01, 0xD5, 0x00, 0xE1, 0x08, 0xE2,
+    0x0B, 0xB8, 0x00, 0xF4, 0x02, 0x30, 0xAE, 0x6D, 0x00, 0xF4, 0x03, 0x00, 0xE3, 0x1E, 0x00, 0xD0,
+    0x1B, 0x10, 0xE9, 0xAE, 0x00, 0x20, 0xFB, 0xED, 0x29, 0xE3, 0x0A, 0x00, 0x10, 0x02, 0x00, 0x00,
+    0x00, 0x36, 0x7C, 0x7C, 0x6B, 0x24, 0x00, 0x03, 0x40, 0x1E, 0xC0, 0x08, 0xF3, 0x02, 0xC7, 0x00,
+    0x8B, 0x00, 0x6D, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x6D, 0x00, 0x9B, 0x00, 0xC7, 0x00, 0xF2, 0x02,
+    0xB0, 0x09, 0x40, 0x1E, 0x00, 0x02, 0x20, 0x00, 0xE4, 0x01, 0xD0, 0x07, 0x60, 0x0D, 0x20, 0x3F,
+    0x00, 0x6D, 0x00, 0x8B, 0x00, 0x9A, 0x00, 0x9A, 0x00, 0x8B, 0x00, 0x6D, 0x20, 0x3F, 0x70, 0x0D,
+    0xD0, 0x07, 0xD5, 0x01, 0x20, 0x00, 0x00, 0x21, 0x00, 0x10, 0x83, 0x10, 0xB1, 0xA8, 0x4B, 0x10,
+    0xEC, 0x05, 0xB1, 0x95, 0x59, 0x00, 0x83, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0xE2, 0x07, 0xE2, 0x0A, 0x60, 0x06, 0xA1, 0x00, 0x41, 0x44, 0x03,
+    0xB2, 0xBB, 0x08, 0xC2, 0x06, 0xF3, 0x08, 0x10, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x89, 0x00,
+    0x10, 0x2E, 0x00, 0x60, 0x0B, 0x00, 0xC0, 0x05, 0x00, 0xE3, 0x01, 0x00, 0x89, 0x00, 0x10, 0x3E,
+    0x00, 0x60, 0x0C, 0x00, 0xC0, 0x06, 0x00, 0xE3, 0x01, 0x00, 0x99, 0x00, 0x00, 0x2A, 0x00, 0x00,
+    0x00, 0x71, 0x89, 0x02, 0x00, 0x20, 0xBD, 0x96, 0x5E, 0x00, 0xB0, 0x0B, 0x00, 0xE7, 0x01, 0xF2,
+    0x05, 0x00, 0xF1, 0x06, 0xF6, 0x01, 0x00, 0xC0, 0x0A, 0xF7, 0x00, 0x00, 0xB0, 0x0C, 0xE8, 0x00,
+    0x00, 0xA0, 0x0C, 0xF7, 0x00, 0x00, 0xB0, 0x0B, 0xF4, 0x03, 0x00, 0xD0, 0x08, 0xE1, 0x07, 0x00,
+    0xF3, 0x04, 0x70, 0x3E, 0x20, 0xBC, 0x00, 0x00, 0xE7, 0xEE, 0x19, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x20, 0x18, 0x00, 0x00, 0xE3, 0x3F, 0x00, 0x40, 0xCE, 0x3F, 0x00, 0xF2, 0x48, 0x3F,
+    0x00, 0x30, 0x40, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x40, 0x3F,
+    0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0xB0, 0xFF, 0xFF,
+    0x7F, 0x00, 0x61, 0x89, 0x04, 0x00, 0x20, 0xBD, 0x86, 0x7E, 0x00, 0xA0, 0x0C, 0x00, 0xF6, 0x01,
+    0x80, 0x04, 0x00, 0xF3, 0x03, 0x00, 0x00, 0x00, 0xF6, 0x02, 0x00, 0x00, 0x10, 0xCD, 0x00, 0x00,
+    0x00, 0xA0, 0x3E, 0x00, 0x00, 0x00, 0xF9, 0x05, 0x00, 0x00, 0x90, 0x6F, 0x00, 0x00, 0x00, 0xF9,
+    0x06, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0xF2, 0xEF, 0xFF, 0xFF, 0x07, 0x00, 0x96, 0x59,
+    0x00, 0xC1, 0x6C, 0xE7, 0x0A, 0xE8, 0x01, 0x40, 0x3F, 0x56, 0x00, 0x20, 0x4F, 0x00, 0x00, 0x60,
+    0x1E, 0x00, 0x60, 0xDA, 0x04, 0x00, 0x60, 0xEA, 0x08, 0x00, 0x00, 0x30, 0x5F, 0x01, 0x00, 0x00,
+    0x8D, 0x7E, 0x00, 0x10, 0x7E, 0xE8, 0x03, 0xA1, 0x1E, 0x80, 0xEE, 0xBE, 0x03, 0x00, 0x20, 0x01,
+    0x00, 0x00, 0x00, 0x20, 0x28, 0x00, 0x00, 0x00, 0xC1, 0x3F, 0x00, 0x00, 0x00, 0xC9, 0x3F, 0x00,
+    0x00, 0x50, 0x3E, 0x3F, 0x00, 0x00, 0xE2, 0x06, 0x3F, 0x00, 0x10, 0xAC, 0x00, 0x3F, 0x00, 0x90,
+    0x1D, 0x00, 0x3F, 0x00, 0xF5, 0x04, 0x00, 0x3F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x50, 0x88, 0x88,
+    0x06, 0xC0, 0x8A, 0x88, 0x05, 0xE0, 0x03, 0x00, 0x00, 0xF2, 0x01, 0x00, 0x00, 0xE5, 0x43, 0x02,
+    0x00, 0xF6, 0xCC, 0xCE, 0x02, 0x00, 0x00, 0xC1, 0x0B, 0x00, 0x00, 0x50, 0x1F, 0x00, 0x00, 0x40,
+    0x2F, 0x00, 0x00, 0x80, 0x0E, 0x58, 0x00, 0xE4, 0x06, 0xD8, 0xEE, 0x6D, 0x00, 0x00, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0x00, 0x00, 0xF5, 0x06, 0x00, 0x00, 0x20, 0x9E, 0x00, 0x00,
+    0x00, 0xC0, 0x1C, 0x00, 0x00, 0x00, 0xE8, 0x02, 0x00, 0x00, 0x30, 0xDF, 0xFE, 0x3B, 0x00, 0xB0,
+    0x5E, 0x20, 0xEB, 0x02, 0xF1, 0x07, 0x00, 0xF1, 0x07, 0xF2, 0x04, 0x00, 0xD0, 0x09, 0xE0, 0x06,
+    0x00, 0xE1, 0x06, 0x80, 0x2D, 0x10, 0xDA, 0x01, 0x00, 0xE8, 0xED, 0x2B, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x81, 0x88, 0x88, 0x88, 0x05, 0x71, 0x88, 0x88, 0xF8, 0x09, 0x00, 0x00, 0x00, 0xF6,
+    0x03, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x50, 0x3F, 0x00, 0x00, 0x00, 0xD0, 0x0B, 0x00,
+    0x00, 0x00, 0xF5, 0x03, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x50, 0x3F, 0x00, 0x00, 0x00,
+    0xC0, 0x0B, 0x00, 0x00, 0x00, 0xF5, 0x04, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x71,
+    0x89, 0x03, 0x00, 0x20, 0xAE, 0x86, 0x5E, 0x00, 0xA0, 0x0B, 0x00, 0xE8, 0x00, 0xC0, 0x09, 0x00,
+    0xF5, 0x01, 0x90, 0x0C, 0x00, 0xD9, 0x00, 0x10, 0xCB, 0xA8, 0x3D, 0x00, 0x30, 0xBC, 0xA8, 0x6D,
+    0x00, 0xE0, 0x09, 0x00, 0xF5, 0x03, 0xF3, 0x04, 0x00, 0xF0, 0x07, 0xF2, 0x05, 0x00, 0xF1, 0x06,
+    0xB0, 0x2D, 0x10, 0xEA, 0x01, 0x10, 0xEA, 0xED, 0x3B, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x95, 0x59, 0x00, 0xB1, 0x7D, 0xD7, 0x0A, 0xE7, 0x01, 0x20, 0x5F, 0xAC, 0x00, 0x00, 0x9C, 0xAC,
+    0x00, 0x00, 0x9D, 0xF7, 0x03, 0x60, 0x6F, 0xA0, 0xCF, 0xED, 0x1E, 0x00, 0x32, 0xE4, 0x06, 0x00,
+    0x10, 0xAC, 0x00, 0x00, 0xA0, 0x1E, 0x00, 0x00, 0xF6, 0x05, 0x00, 0x30, 0x9F, 0x00, 0x00, 0xCB,
+    0xCB, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xDD, 0x11, 0xCB, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0xFB,
+    0xA2, 0x29, 0x00, 0x00, 0x70, 0x04, 0x00, 0x60, 0xDD, 0x03, 0x50, 0xDD, 0x05, 0x00, 0xFB, 0x07,
+    0x00, 0x00, 0x92, 0x9E, 0x02, 0x00, 0x00, 0xA2, 0x9F, 0x01, 0x00, 0x00, 0xA2, 0x06, 0x43, 0x44,
+    0x44, 0x04, 0xB9, 0xBB, 0xBB, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x86, 0x88, 0x88, 0x18, 0x86, 0x88,
+    0x88, 0x18, 0x91, 0x01, 0x00, 0x00, 0xA0, 0x8E, 0x01, 0x00, 0x00, 0xB3, 0x8E, 0x01, 0x00, 0x00,
+    0xE4, 0x1E, 0x00, 0x71, 0xBE, 0x03, 0x70, 0xCE, 0x04, 0x00, 0xC1, 0x04, 0x00, 0x00, 0x50, 0x99,
+    0x05, 0xC8, 0x77, 0x9E, 0x01, 0x00, 0xF5, 0x00, 0x00, 0xF6, 0x00, 0x20, 0x9D, 0x00, 0xE3, 0x09,
+    0x00, 0xAA, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8B, 0x00, 0x10,
+    0xAE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x94, 0xBB, 0x38, 0x00, 0x00, 0x00, 0xB1, 0x7C, 0x44,
+    0xD7, 0x08, 0x00, 0x10, 0x8C, 0x00, 0x00, 0x10, 0x8A, 0x00, 0x80, 0x0A, 0x00, 0x74, 0x27, 0xE1,
+    0x02, 0xE0, 0x02, 0xC1, 0x8C, 0x6D, 0xA0, 0x06, 0xD3, 0x00, 0x9A, 0x00, 0x2E, 0x80, 0x07, 0xB4,
+    0x10, 0x1F, 0x30, 0x0D, 0x90, 0x07, 0xC4, 0x30, 0x0E, 0x80, 0x0A, 0xD0, 0x03, 0xE1, 0x11, 0x6F,
+    0xC6, 0x4D, 0x9A, 0x00, 0xB0, 0x07, 0xB5, 0x19, 0xB7, 0x07, 0x00, 0x20, 0x4E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE4, 0x39, 0x01, 0x41, 0x6A, 0x00, 0x00, 0x10, 0xC7, 0xFE, 0xBE, 0x05, 0x00,
+    0x00, 0x00, 0x83, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x0A, 0x00, 0x00, 0x00, 0x20, 0xBF, 0x1E,
+    0x00, 0x00, 0x00, 0x80, 0x1E, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x08, 0xCA, 0x00, 0x00, 0x00, 0xF5,
+    0x03, 0xF4, 0x03, 0x00, 0x00, 0xCB, 0x00, 0xD0, 0x09, 0x00, 0x20, 0x9F, 0x44, 0xA4, 0x1E, 0x00,
+    0x80, 0xBE, 0xBB, 0xBB, 0x6F, 0x00, 0xE0, 0x09, 0x00, 0x00, 0xCA, 0x00, 0xF5, 0x03, 0x00, 0x00,
+    0xF5, 0x03, 0xCB, 0x00, 0x00, 0x00, 0xD0, 0x09, 0x85, 0x88, 0x57, 0x01, 0x00, 0xF9, 0x88, 0xC8,
+    0x5E, 0x00, 0xE9, 0x00, 0x00, 0xEB, 0x00, 0xE9, 0x00, 0x00, 0xF7, 0x01, 0xE9, 0x00, 0x00, 0xDA,
+    0x00, 0xE9, 0x44, 0x94, 0x3D, 0x00, 0xF9, 0xBB, 0xDB, 0x3B, 0x00, 0xE9, 0x00, 0x00, 0xF8, 0x02,
+    0xE9, 0x00, 0x00, 0xF1, 0x07, 0xE9, 0x00, 0x00, 0xF3, 0x06, 0xE9, 0x00, 0x30, 0xDB, 0x01, 0xF9,
+    0xFF, 0xEF, 0x29, 0x00, 0x00, 0x00, 0x85, 0x89, 0x15, 0x00, 0x00, 0xD3, 0x7D, 0x76, 0xED, 0x01,
+    0x20, 0xAE, 0x00, 0x00, 0x50, 0x00, 0xA0, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0xEB, 0x05, 0x10, 0xE7, 0x01, 0x00, 0x70, 0xED, 0xED, 0x5C, 0x00, 0x00, 0x00, 0x10, 0x02,
+    0x00, 0x00, 0x85, 0x88, 0x77, 0x04, 0x00, 0x00, 0xF9, 0x88, 0x98, 0xCD, 0x03, 0x00, 0xE9, 0x00,
+    0x00, 0x90, 0x2E, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xF7, 0x02,
+    0xE9, 0x00, 0x00, 0x00, 0xF5, 0x04, 0xE9, 0x00, 0x00, 0x00, 0xF4, 0x05, 0xE9, 0x00, 0x00, 0x00,
+    0xF6, 0x03, 0xE9, 0x00, 0x00, 0x00, 0xEA, 0x00, 0xE9, 0x00, 0x00, 0x30, 0x7F, 0x00, 0xE9, 0x00,
+    0x10, 0xE6, 0x0A, 0x00, 0xF9, 0xFF, 0xEF, 0x5B, 0x00, 0x00, 0x85, 0x88, 0x88, 0x38, 0xF9, 0x88,
+    0x88, 0x38, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x44,
+    0x44, 0x02, 0xF9, 0xBB, 0xBB, 0x05, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00,
+    0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x7F, 0x85, 0x88, 0x88, 0x38, 0xF9, 0x88,
+    0x88, 0x38, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00,
+    0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0A, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00,
+    0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x99, 0x26, 0x00,
+    0x00, 0xD3, 0x7D, 0x76, 0xFC, 0x06, 0x20, 0x9E, 0x00, 0x00, 0x50, 0x01, 0xB0, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x05,
+    0x00, 0x60, 0x88, 0x06, 0xF2, 0x06, 0x00, 0x50, 0xC8, 0x0B, 0xD0, 0x0B, 0x00, 0x00, 0xA0, 0x0B,
+    0x60, 0x4F, 0x00, 0x00, 0xA0, 0x0B, 0x00, 0xEA, 0x06, 0x00, 0xD4, 0x0B, 0x00, 0x60, 0xFC, 0xED,
+    0xAE, 0x04, 0x00, 0x00, 0x10, 0x12, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x57, 0xE9, 0x00, 0x00,
+    0x00, 0xAD, 0xE9, 0x00, 0x00, 0x00, 0xAD, 0xE9, 0x00, 0x00, 0x00, 0xAD, 0xE9, 0x00, 0x00, 0x00,
+    0xAD, 0xE9, 0x44, 0x44, 0x44, 0xAE, 0xF9, 0xBB, 0xBB, 0xBB, 0xAF, 0xE9, 0x00, 0x00, 0x00, 0xAD,
+    0xE9, 0x00, 0x00, 0x00, 0xAD, 0xE9, 0x00, 0x00, 0x00, 0xAD, 0xE9, 0x00, 0x00, 0x00, 0xAD, 0xE9,
+    0x00, 0x00, 0x00, 0xAD, 0x82, 0x02, 0xF5, 0x03, 0xF5, 0x03, 0xF5, 0x03, 0xF5, 0x03, 0xF5, 0x03,
+    0xF5, 0x03, 0xF5, 0x03, 0xF5, 0x03, 0xF5, 0x03, 0xF5, 0x03, 0xF5, 0x03, 0x00, 0x00, 0x56, 0x00,
+    0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00,
+    0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x8E, 0x00, 0x80, 0x2F, 0xE7, 0xDE, 0x04,
+    0x10, 0x01, 0x00, 0x83, 0x01, 0x00, 0x40, 0x17, 0xF7, 0x01, 0x00, 0xF3, 0x08, 0xF7, 0x01, 0x20,
+    0xAE, 0x00, 0xF7, 0x01, 0xD1, 0x1C, 0x00, 0xF7, 0x01, 0xDB, 0x01, 0x00, 0xF7, 0x95, 0x2E, 0x00,
+    0x00, 0xF7, 0xEC, 0x1D, 0x00, 0x00, 0xF7, 0x11, 0xCD, 0x01, 0x00, 0xF7, 0x01, 0xE2, 0x0A, 0x00,
+    0xF7, 0x01, 0x40, 0x8F, 0x00, 0xF7, 0x01, 0x00, 0xF5, 0x06, 0xF7, 0x01, 0x00, 0x70, 0x4F, 0x75,
+    0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9,
+    0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9,
+    0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0x0E, 0x75,
+    0x01, 0x00, 0x00, 0x00, 0x72, 0x02, 0xF9, 0x07, 0x00, 0x00, 0x00, 0xFB, 0x05, 0xF9, 0x1E, 0x00,
+    0x00, 0x50, 0xFF, 0x05, 0xC9, 0x9D, 0x00, 0x00, 0xD0, 0xFA, 0x05, 0xB9, 0xF5, 0x03, 0x00, 0xE6,
+    0xF2, 0x05, 0xB9, 0xC0, 0x0B, 0x10, 0x8E, 0xF1, 0x05, 0xB9, 0x40, 0x4F, 0x80, 0x1E, 0xF1, 0x05,
+    0xB9, 0x00, 0xCA, 0xE2, 0x06, 0xF1, 0x05, 0xB9, 0x00, 0xF2, 0xDC, 0x00, 0xF1, 0x05, 0xB9, 0x00,
+    0x80, 0x5F, 0x00, 0xF1, 0x05, 0xB9, 0x00, 0x10, 0x05, 0x00, 0xF1, 0x05, 0xB9, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0x05, 0x55, 0x00, 0x00, 0x00, 0x55, 0xF9, 0x04, 0x00, 0x00, 0xAA, 0xF9, 0x2E, 0x00,
+    0x00, 0xAA, 0xC9, 0xCD, 0x00, 0x00, 0xAA, 0xB9, 0xF3, 0x09, 0x00, 0xAA, 0xB9, 0x60, 0x5F, 0x00,
+    0xAA, 0xB9, 0x00, 0xEA, 0x03, 0xAA, 0xB9, 0x00, 0xD1, 0x1D, 0xAA, 0xB9, 0x00, 0x30, 0xAE, 0xAA,
+    0xB9, 0x00, 0x00, 0xF5, 0xAE, 0xB9, 0x00, 0x00, 0x90, 0xAF, 0xB9, 0x00, 0x00, 0x00, 0xAC, 0x00,
+    0x00, 0x85, 0x89, 0x04, 0x00, 0x00, 0xD3, 0x7C, 0x86, 0xBE, 0x01, 0x20, 0x9E, 0x00, 0x00, 0xC1,
+    0x1C, 0xA0, 0x0D, 0x00, 0x00, 0x20, 0x7F, 0xF1, 0x08, 0x00, 0x00, 0x00, 0xCC, 0xF3, 0x05, 0x00,
+    0x00, 0x00, 0xF9, 0xF4, 0x05, 0x00, 0x00, 0x00, 0xF8, 0xF2, 0x06, 0x00, 0x00, 0x00, 0xEA, 0xD0,
+    0x0A, 0x00, 0x00, 0x00, 0xAE, 0x60, 0x3F, 0x00, 0x00, 0x60, 0x3F, 0x00, 0xEA, 0x05, 0x10, 0xF7,
+    0x07, 0x00, 0x60, 0xED, 0xFD, 0x4B, 0x00, 0x00, 0x00, 0x10, 0x12, 0x00, 0x00, 0x83, 0x88, 0x57,
+    0x01, 0x00, 0xF7, 0x88, 0xC8, 0x4E, 0x00, 0xF7, 0x01, 0x00, 0xDB, 0x00, 0xF7, 0x01, 0x00, 0xF6,
+    0x03, 0xF7, 0x01, 0x00, 0xF6, 0x02, 0xF7, 0x01, 0x10, 0xDC, 0x00, 0xF7, 0x88, 0xD8, 0x3D, 0x00,
+    0xF7, 0x88, 0x57, 0x00, 0x00, 0xF7, 0x01, 0x00, 0x00, 0x00, 0xF7, 0x01, 0x00, 0x00, 0x00, 0xF7,
+    0x01, 0x00, 0x00, 0x00, 0xF7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x89, 0x04, 0x00, 0x00,
+    0x00, 0xD3, 0x7C, 0x86, 0xBE, 0x01, 0x00, 0x20, 0x9E, 0x00, 0x00, 0xC1, 0x0C, 0x00, 0xA0, 0x0D,
+    0x00, 0x00, 0x20, 0x6F, 0x00, 0xF1, 0x08, 0x00, 0x00, 0x00, 0xCC, 0x00, 0xF3, 0x05, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0xF4, 0x05, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF2, 0x06, 0x00, 0x00, 0x00, 0xEA,
+    0x00, 0xD0, 0x0A, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x60, 0x3F, 0x00, 0x00, 0x60, 0x5F, 0x00, 0x00,
+    0xEA, 0x05, 0x10, 0xF7, 0x0A, 0x00, 0x00, 0x60, 0xED, 0xFD, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x12, 0xE2, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x62, 0x02, 0x83, 0x78, 0x57, 0x01, 0x00, 0xF7, 0x88, 0xD8, 0x3D, 0x00, 0xF7, 0x01, 0x10, 0xBD,
+    0x00, 0xF7, 0x01, 0x00, 0xE8, 0x00, 0xF7, 0x01, 0x00, 0xDA, 0x00, 0xF7, 0x01, 0x40, 0x7F, 0x00,
+    0xF7, 0xBC, 0xED, 0x07, 0x00, 0xF7, 0x55, 0xAE, 0x00, 0x00, 0xF7, 0x01, 0xF5, 0x06, 0x00, 0xF7,
+    0x01, 0x90, 0x3F, 0x00, 0xF7, 0x01, 0x00, 0xDC, 0x01, 0xF7, 0x01, 0x00, 0xE2, 0x0A, 0x00, 0x72,
+    0x89, 0x04, 0x40, 0x9E, 0x86, 0x7E, 0xC0, 0x09, 0x00, 0x12, 0xF0, 0x07, 0x00, 0x00, 0xE0, 0x4E,
+    0x00, 0x00, 0x60, 0xFF, 0x8D, 0x02, 0x00, 0xB4, 0xFF, 0x3E, 0x00, 0x00, 0x71, 0xBF, 0x00, 0x00,
+    0x00, 0xDA, 0x00, 0x00, 0x00, 0xBA, 0xE4, 0x05, 0x40, 0x4E, 0x81, 0xEE, 0xDE, 0x05, 0x00, 0x10,
+    0x01, 0x00, 0x86, 0x88, 0x88, 0x88, 0x28, 0x86, 0x88, 0xBF, 0x88, 0x28, 0x00, 0x10, 0x7F, 0x00,
+    0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x00,
+    0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x00,
+    0x10, 0x7F, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x00, 0x00, 0x65, 0x00,
+    0x00, 0x10, 0x38, 0xCB, 0x00, 0x00, 0x20, 0x6F, 0xCB, 0x00, 0x00, 0x20, 0x6F, 0xCB, 0x00, 0x00,
+    0x20, 0x6F, 0xCB, 0x00, 0x00, 0x20, 0x6F, 0xCB, 0x00, 0x00, 0x20, 0x6F, 0xCB, 0x00, 0x00, 0x20,
+    0x6F, 0xCB, 0x00, 0x00, 0x20, 0x6F, 0xE9, 0x00, 0x00, 0x30, 0x5F, 0xF5, 0x03, 0x00, 0x80, 0x1E,
+    0xB0, 0x3D, 0x00, 0xF6, 0x06, 0x10, 0xE8, 0xEE, 0x5D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x56,
+    0x00, 0x00, 0x00, 0x60, 0x05, 0xF8, 0x02, 0x00, 0x00, 0xF3, 0x06, 0xF2, 0x07, 0x00, 0x00, 0xE9,
+    0x01, 0xB0, 0x0D, 0x00, 0x10, 0x9E, 0x00, 0x50, 0x4F, 0x00, 0x60, 0x3F, 0x00, 0x00, 0xAD, 0x00,
+    0xC0, 0x0C, 0x00, 0x00, 0xF8, 0x01, 0xF3, 0x06, 0x00, 0x00, 0xF2, 0x07, 0xE9, 0x01, 0x00, 0x00,
+    0xA0, 0x1D, 0x8E, 0x00, 0x00, 0x00, 0x40, 0x9F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x66, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x83, 0x01,
+    0xF9, 0x02, 0x00, 0xB0, 0x2F, 0x00, 0x00, 0xDB, 0x00, 0xF4, 0x06, 0x00, 0xF2, 0x7F, 0x00, 0x10,
+    0x8F, 0x00, 0xE0, 0x0B, 0x00, 0xE7, 0xD9, 0x00, 0x50, 0x4F, 0x00, 0xA0, 0x1E, 0x00, 0x9C, 0xF4,
+    0x03, 0x90, 0x0E, 0x00, 0x50, 0x5F, 0x20, 0x4F, 0xE0, 0x08, 0xE0, 0x09, 0x00, 0x10, 0x9F, 0x70,
+    0x0E, 0x90, 0x0D, 0xF3, 0x05, 0x00, 0x00, 0xDB, 0xC0, 0x09, 0x40, 0x3F, 0xE8, 0x01, 0x00, 0x00,
+    0xF6, 0xF5, 0x04, 0x00, 0x8E, 0xAC, 0x00, 0x00, 0x00, 0xF1, 0xED, 0x00, 0x00, 0xD9, 0x6F, 0x00,
+    0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x00, 0x00, 0x70, 0x4F, 0x00, 0x00, 0xE0,
+    0x0B, 0x00, 0x00, 0x74, 0x02, 0x00, 0x00, 0x66, 0xE2, 0x0B, 0x00, 0x50, 0x5F, 0x60, 0x6F, 0x00,
+    0xE1, 0x0A, 0x00, 0xEB, 0x01, 0xDA, 0x01, 0x00, 0xE1, 0x5A, 0x4F, 0x00, 0x00, 0x50, 0xEF, 0x09,
+    0x00, 0x00, 0x30, 0xFF, 0x08, 0x00, 0x00, 0xD1, 0x8C, 0x3F, 0x00, 0x00, 0xE8, 0x02, 0xCD, 0x00,
+    0x30, 0x7F, 0x00, 0xF3, 0x08, 0xD1, 0x0C, 0x00, 0x90, 0x3F, 0xE8, 0x02, 0x00, 0x10, 0xCD, 0x66,
+    0x00, 0x00, 0x00, 0x66, 0xF5, 0x05, 0x00, 0x40, 0x6F, 0xB0, 0x1D, 0x00, 0xC0, 0x0C, 0x20, 0x8F,
+    0x00, 0xF6, 0x03, 0x00, 0xF8, 0x12, 0x9E, 0x00, 0x00, 0xD1, 0x9A, 0x1E, 0x00, 0x00, 0x50, 0xEF,
+    0x06, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00,
+    0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x80, 0x88, 0x88, 0x88, 0x38,
+    0x80, 0x88, 0x88, 0xE8, 0x3F, 0x00, 0x00, 0x00, 0xF5, 0x09, 0x00, 0x00, 0x20, 0xDE, 0x01, 0x00,
+    0x00, 0xB0, 0x3F, 0x00, 0x00, 0x00, 0xF6, 0x08, 0x00, 0x00, 0x20, 0xCE, 0x00, 0x00, 0x00, 0xC0,
+    0x3F, 0x00, 0x00, 0x00, 0xF7, 0x07, 0x00, 0x00, 0x30, 0xBF, 0x00, 0x00, 0x00, 0xD1, 0x2E, 0x00,
+    0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x4F, 0x86, 0x18, 0xAD, 0x07, 0x5D, 0x00, 0x5D, 0x00, 0x5D,
+    0x00, 0x5D, 0x00, 0x5D, 0x00, 0x5D, 0x00, 0x5D, 0x00, 0x5D, 0x00, 0x5D, 0x00, 0x5D, 0x00, 0x5D,
+    0x00, 0x5D, 0x00, 0xDD, 0x1B, 0x43, 0x04, 0x1A, 0x00, 0x00, 0x7A, 0x00, 0x00, 0xD4, 0x00, 0x00,
+    0xD0, 0x04, 0x00, 0x70, 0x0A, 0x00, 0x10, 0x2E, 0x00, 0x00, 0x7A, 0x00, 0x00, 0xD4, 0x00, 0x00,
+    0xD0, 0x05, 0x00, 0x70, 0x0B, 0x00, 0x10, 0x2E, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x93, 0x82, 0x58,
+    0x72, 0xAC, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xA8,
+    0x00, 0xA8, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xA8, 0xB3, 0xAD, 0x41, 0x24, 0x00, 0x70,
+    0x01, 0x00, 0x00, 0xF6, 0x09, 0x00, 0x10, 0x7E, 0x3E, 0x00, 0x80, 0x0C, 0xB8, 0x00, 0xF2, 0x04,
+    0xE1, 0x04, 0x75, 0x00, 0x50, 0x07, 0xBB, 0xBB, 0xBB, 0x03, 0x44, 0x44, 0x44, 0x01, 0x94, 0x02,
+    0xA0, 0x0C, 0x00, 0x38, 0x00, 0x10, 0x02, 0x00, 0x40, 0xEC, 0xDE, 0x03, 0x70, 0x06, 0xA0, 0x0D,
+    0x00, 0x00, 0x50, 0x1F, 0x00, 0x41, 0xA7, 0x2F, 0x70, 0xBE, 0xA8, 0x2F, 0xF2, 0x05, 0x40, 0x2F,
+    0xF3, 0x04, 0xB2, 0x2F, 0x90, 0xDF, 0x4C, 0x2F, 0x00, 0x11, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+    0xAC, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0xAC, 0x10, 0x02, 0x00, 0xAC, 0xD9, 0xDE, 0x03,
+    0xEC, 0x05, 0xB1, 0x0D, 0xAC, 0x00, 0x40, 0x3F, 0xAC, 0x00, 0x20, 0x5F, 0xAC, 0x00, 0x20, 0x5F,
+    0xAC, 0x00, 0x60, 0x2F, 0xEC, 0x04, 0xD3, 0x0A, 0x9C, 0xFA, 0x9E, 0x00, 0x00, 0x10, 0x02, 0x00,
+    0x10, 0xFA, 0xED, 0x08, 0xB0, 0x2C, 0x20, 0x05, 0xF3, 0x04, 0x00, 0x00, 0xF6, 0x01, 0x00, 0x00,
+    0xF6, 0x01, 0x00, 0x00, 0xF3, 0x05, 0x00, 0x00, 0xA0, 0x3D, 0x40, 0x0A, 0x10, 0xE9, 0xCF, 0x06,
+    0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x10, 0x01, 0xBB,
+    0x10, 0xFB, 0xCE, 0xBC, 0xC0, 0x1C, 0x20, 0xBE, 0xF3, 0x04, 0x00, 0xBB, 0xF6, 0x01, 0x00, 0xBB,
+    0xF6, 0x01, 0x00, 0xBB, 0xF4, 0x04, 0x00, 0xBB, 0xD0, 0x2B, 0x71, 0xBE, 0x20, 0xFC, 0x7D, 0xB8,
+    0x00, 0x10, 0x02, 0x00, 0x10, 0xEA, 0xED, 0x06, 0xB0, 0x1B, 0x30, 0x4E, 0xF3, 0x03, 0x00, 0x99,
+    0xF6, 0xFF, 0xFF, 0xBF, 0xF5, 0x01, 0x00, 0x00, 0xF2, 0x05, 0x00, 0x00, 0x90, 0x3D, 0x20, 0x58,
+    0x00, 0xD8, 0xDF, 0x29, 0x00, 0x82, 0x29, 0x10, 0xAE, 0x16, 0x60, 0x0E, 0x00, 0x80, 0x0D, 0x00,
+    0xFB, 0xFF, 0x3F, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80,
+    0x0E, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x0E, 0x00, 0x00, 0x10, 0x01, 0x00, 0x40, 0xED, 0xCE, 0x9A,
+    0xE1, 0x07, 0xA0, 0x2D, 0xF2, 0x02, 0x50, 0x0E, 0xD0, 0x19, 0xB1, 0x0A, 0x40, 0xEE, 0xAE, 0x01,
+    0xC0, 0x06, 0x00, 0x00, 0xA0, 0xCE, 0xBB, 0x18, 0xC2, 0x45, 0x64, 0x9D, 0xA8, 0x00, 0x00, 0xA9,
+    0xE5, 0x26, 0x73, 0x3E, 0x50, 0xDB, 0x9D, 0x03, 0x79, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00,
+    0x9C, 0x00, 0x00, 0x00, 0x9C, 0x10, 0x01, 0x00, 0xAC, 0xEA, 0xCE, 0x02, 0xEC, 0x04, 0xD1, 0x0A,
+    0x9C, 0x00, 0x80, 0x0D, 0x9C, 0x00, 0x80, 0x0E, 0x9C, 0x00, 0x80, 0x0E, 0x9C, 0x00, 0x80, 0x0E,
+    0x9C, 0x00, 0x80, 0x0E, 0x9C, 0x00, 0x80, 0x0E, 0x87, 0xED, 0x21, 0x00, 0xBA, 0xBA, 0xBA, 0xBA,
+    0xBA, 0xBA, 0xBA, 0xBA, 0x00, 0x87, 0x00, 0xED, 0x00, 0x21, 0x00, 0x00, 0x00, 0xBA, 0x00, 0xBA,
+    0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x31, 0x9D,
+    0xD5, 0x1A, 0x79, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0xAC, 0x00,
+    0x00, 0x00, 0xAC, 0x00, 0xE3, 0x07, 0xAC, 0x20, 0x8E, 0x00, 0xAC, 0xD2, 0x09, 0x00, 0xEC, 0xCE,
+    0x00, 0x00, 0xBC, 0xF7, 0x04, 0x00, 0xAC, 0x80, 0x2E, 0x00, 0xAC, 0x00, 0xDA, 0x01, 0xAC, 0x00,
+    0xC1, 0x0B, 0x88, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0x00, 0x10,
+    0x01, 0x00, 0x02, 0x00, 0x8C, 0xEB, 0x5E, 0xE6, 0xEE, 0x04, 0xDC, 0x02, 0xE6, 0x1C, 0xA0, 0x0D,
+    0x9C, 0x00, 0xF1, 0x06, 0x50, 0x2F, 0x9C, 0x00, 0xF1, 0x05, 0x40, 0x2F, 0x9C, 0x00, 0xF1, 0x05,
+    0x40, 0x2F, 0x9C, 0x00, 0xF1, 0x05, 0x40, 0x2F, 0x9C, 0x00, 0xF1, 0x05, 0x40, 0x2F, 0x9C, 0x00,
+    0xF1, 0x05, 0x40, 0x2F, 0x00, 0x10, 0x01, 0x00, 0x7C, 0xEA, 0xCE, 0x02, 0xEC, 0x04, 0xD1, 0x0A,
+    0x9C, 0x00, 0x80, 0x0D, 0x9C, 0x00, 0x80, 0x0E, 0x9C, 0x00, 0x80, 0x0E, 0x9C, 0x00, 0x80, 0x0E,
+    0x9C, 0x00, 0x80, 0x0E, 0x9C, 0x00, 0x80, 0x0E, 0x00, 0x10, 0x02, 0x00, 0x00, 0x10, 0xEA, 0xED,
+    0x19, 0x00, 0xB0, 0x1C, 0x20, 0x9D, 0x00, 0xF3, 0x04, 0x00, 0xF6, 0x02, 0xF6, 0x01, 0x00, 0xF3,
+    0x04, 0xF6, 0x01, 0x00, 0xF3, 0x04, 0xF3, 0x05, 0x00, 0xF6, 0x01, 0xA0, 0x3D, 0x40, 0x8E, 0x00,
+    0x00, 0xD8, 0xDF, 0x07, 0x00, 0x00, 0x10, 0x02, 0x00, 0x7C, 0xDA, 0xDF, 0x03, 0xEC, 0x04, 0xC1,
+    0x0C, 0x9C, 0x00, 0x50, 0x2F, 0x9C, 0x00, 0x30, 0x4F, 0x9C, 0x00, 0x30, 0x4F, 0x9C, 0x00, 0x60,
+    0x1F, 0xDC, 0x03, 0xE4, 0x09, 0xBC, 0xFB, 0x8E, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x9C, 0x00, 0x00,
+    0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x10, 0xFB, 0xCE, 0xBA, 0xC0, 0x1C, 0x30,
+    0xBE, 0xF3, 0x04, 0x00, 0xBB, 0xF6, 0x01, 0x00, 0xBB, 0xF6, 0x01, 0x00, 0xBB, 0xF4, 0x04, 0x00,
+    0xBB, 0xD0, 0x2B, 0x71, 0xBF, 0x20, 0xFC, 0x7D, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x00, 0x00, 0x88, 0x00, 0x10, 0x01, 0x7C, 0xEA, 0x0E, 0xEC, 0x05, 0x00, 0xAC, 0x00,
+    0x00, 0x9C, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x9C, 0x00, 0x00,
+    0x00, 0x20, 0x01, 0x00, 0x60, 0xDE, 0xAE, 0x00, 0xF2, 0x05, 0x51, 0x00, 0xF4, 0x04, 0x00, 0x00,
+    0xB0, 0xCF, 0x17, 0x00, 0x00, 0x94, 0xDE, 0x01, 0x00, 0x00, 0xF3, 0x04, 0x72, 0x01, 0xF5, 0x01,
+    0xC3, 0xEE, 0x5D, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x20, 0x1F, 0x00, 0x40, 0x1F,
+    0x00, 0xF8, 0xFF, 0x6F, 0x60, 0x1F, 0x00, 0x60, 0x1F, 0x00, 0x60, 0x1F, 0x00, 0x60, 0x1F, 0x00,
+    0x60, 0x1F, 0x00, 0x50, 0x2F, 0x11, 0x10, 0xEC, 0x5E, 0x00, 0x20, 0x00, 0x6F, 0x00, 0xB0, 0x0B,
+    0x6F, 0x00, 0xB0, 0x0B, 0x6F, 0x00, 0xB0, 0x0B, 0x6F, 0x00, 0xB0, 0x0B, 0x6F, 0x00, 0xB0, 0x0B,
+    0x6F, 0x00, 0xB0, 0x0B, 0xBC, 0x01, 0xE5, 0x0B, 0xD3, 0xEE, 0x99, 0x0B, 0x00, 0x12, 0x00, 0x00,
+    0xCA, 0x00, 0x00, 0xC8, 0xF4, 0x04, 0x10, 0x6E, 0xC0, 0x0A, 0x60, 0x1E, 0x60, 0x1E, 0xC0, 0x09,
+    0x10, 0x6E, 0xF3, 0x03, 0x00, 0xC9, 0xC9, 0x00, 0x00, 0xF3, 0x5E, 0x00, 0x00, 0xB0, 0x0E, 0x00,
+    0xBB, 0x00, 0x90, 0x0E, 0x00, 0xE6, 0x01, 0xF6, 0x01, 0xE0, 0x4E, 0x00, 0xAB, 0x00, 0xF1, 0x05,
+    0xD4, 0x99, 0x10, 0x5F, 0x00, 0xB0, 0x0A, 0x89, 0xE4, 0x50, 0x1E, 0x00, 0x60, 0x0E, 0x3E, 0xE0,
+    0x94, 0x0A, 0x00, 0x10, 0x7F, 0x0D, 0x90, 0xE9, 0x05, 0x00, 0x00, 0xEB, 0x08, 0x40, 0xFE, 0x01,
+    0x00, 0x00, 0xF6, 0x03, 0x00, 0xAE, 0x00, 0x00, 0xF5, 0x04, 0x30, 0x5E, 0x90, 0x1D, 0xC0, 0x0A,
+    0x10, 0x9D, 0xD8, 0x01, 0x00, 0xF3, 0x4F, 0x00, 0x00, 0xE5, 0x7E, 0x00, 0x20, 0x7E, 0xE6, 0x02,
+    0xB0, 0x0B, 0xB0, 0x0C, 0xE6, 0x02, 0x20, 0x7E, 0xDA, 0x00, 0x00, 0xD8, 0xF3, 0x04, 0x10, 0x6E,
+    0xC0, 0x0B, 0x60, 0x1E, 0x50, 0x2F, 0xC0, 0x08, 0x00, 0x9D, 0xF4, 0x02, 0x00, 0xE7, 0xAA, 0x00,
+    0x00, 0xE1, 0x4F, 0x00, 0x00, 0xA0, 0x0C, 0x00, 0x00, 0xE1, 0x06, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x6A, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF3, 0x05, 0x00, 0x10, 0x9D, 0x00,
+    0x00, 0xA0, 0x1C, 0x00, 0x00, 0xE7, 0x02, 0x00, 0x30, 0x5F, 0x00, 0x00, 0xD1, 0x09, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0x0A, 0x00, 0x74, 0x01, 0x70, 0x8E, 0x00, 0xD0, 0x06, 0x00, 0xE0, 0x05, 0x00,
+    0xC0, 0x06, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0xD5, 0x03, 0x00, 0xD5, 0x04, 0x00, 0x90,
+    0x09, 0x00, 0xA0, 0x09, 0x00, 0xC0, 0x06, 0x00, 0xE0, 0x05, 0x00, 0xD0, 0x07, 0x00, 0x50, 0xCE,
+    0x01, 0x00, 0x41, 0x00, 0x41, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xE2, 0xE2, 0xE2, 0xB2, 0x72, 0x03, 0x00, 0x92, 0x4E, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xB8, 0x00,
+    0x00, 0x9A, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x6C, 0x00, 0x00, 0xD6, 0x04, 0x00, 0xD6, 0x04, 0x00,
+    0x6C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x99, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xAA, 0x00, 0xC3, 0x3E,
+    0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xA2, 0x5A, 0x00, 0x4E, 0x9C, 0xB5, 0xDD, 0x0B,
+    0x19, 0x00, 0x32, 0x00,
+};
+
+static const MLCD_Glyph_t mlcd_font_aa16_glyphs[95] = {
+    {    0,  0,  0,   0,   0,  3}, // ' '
+    {    0,  3, 13,   1,   4,  6}, // '!'
+    {   26,  5,  5,   1,   4,  6}, // '"'
+    {   41,  9, 12,   0,   4,  9}, // '#'
+    {  101,  8, 16,   1,   2,  9}, // '$'
+    {  165, 12, 13,   0,   4, 12}, // '%'
+    {  243, 11, 13,   0,   4, 11}, // '&'
+    {  321,  2,  5,   1,   4,  4}, // '''
+    {  326,  4, 16,   1,   3,  5}, // '('
+    {  358,  4, 16,   0,   3,  5}, // ')'
+    {  390,  6,  6,   0,   3,  6}, // 'asterisk'
+    {  408,  9,  9,   0,   6,  9}, // '+'
+    {  453,  3,  4,   0,  14,  4}, // ','
+    {  461,  5,  2,   0,  10,  6}, // '-'
+    {  467,  3,  3,   0,  14,  4}, // '.'
+    {  473,  6, 13,   0,   4,  6}, // 'slash'
+    {  512,  9, 13,   0,   4,  9}, // '0'
+    {  577,  8, 12,   1,   4,  9}, // '1'
+    {  625,  9, 12,   0,   4,  9}, // '2'
+    {  685,  8, 13,   1,   4,  9}, // '3'
+    {  737,  9, 12,   0,   4,  9}, // '4'
+    {  797,  8, 13,   1,   4,  9}, // '5'
+    {  849,  9, 13,   0,   4,  9}, // '6'
+    {  914,  9, 12,   0,   4,  9}, // '7'
+    {  974,  9, 13,   0,   4,  9}, // '8'
+    { 1039,  8, 12,   1,   4,  9}, // '9'
+    { 1087,  2,  9,   1,   8,  4}, // ':'
+    { 1096,  2, 10,   1,   8,  4}, // ';'
+    { 1106,  7,  7,   1,   7,  9}, // '<'
+    { 1134,  8,  5,   1,   8,  9}, // '='
+    { 1154,  8,  7,   1,   7,  9}, // '>'
+    { 1182,  6, 13,   0,   4,  6}, // '?'
+    { 1221, 13, 13,   0,   5, 13}, // '@'
+    { 1312, 11, 12,   0,   4, 11}, // 'A'
+    { 1384,  9, 12,   1,   4, 10}, // 'B'
+    { 1444, 11, 13,   0,   4, 11}, // 'C'
+    { 1522, 11, 12,   1,   4, 12}, // 'D'
+    { 1594,  8, 12,   1,   4,  9}, // 'E'
+    { 1642,  8, 12,   1,   4,  9}, // 'F'
+    { 1690, 11, 13,   0,   4, 12}, // 'G'
+    { 1768, 10, 12,   1,   4, 12}, // 'H'
+    { 1828,  3, 12,   1,   4,  5}, // 'I'
+    { 1852,  6, 13,   0,   4,  7}, // 'J'
+    { 1891, 10, 12,   1,   4, 11}, // 'K'
+    { 1951,  7, 12,   1,   4,  8}, // 'L'
+    { 1999, 13, 12,   1,   4, 15}, // 'M'
+    { 2083, 10, 12,   1,   4, 12}, // 'N'
+    { 2143, 12, 13,   0,   4, 13}, // 'O'
+    { 2221,  9, 12,   1,   4, 10}, // 'P'
+    { 2281, 13, 15,   0,   4, 13}, // 'Q'
+    { 2386,  9, 12,   1,   4, 10}, // 'R'
+    { 2446,  8, 13,   0,   4,  8}, // 'S'
+    { 2498, 10, 12,   0,   4, 10}, // 'T'
+    { 2558, 10, 13,   1,   4, 12}, // 'U'
+    { 2623, 11, 12,   0,   4, 11}, // 'V'
+    { 2695, 17, 12,   0,   4, 16}, // 'W'
+    { 2803, 10, 12,   0,   4, 10}, // 'X'
+    { 2863, 10, 12,   0,   4, 10}, // 'Y'
+    { 2923, 10, 12,   0,   4, 10}, // 'Z'
+    { 2983,  4, 16,   1,   3,  5}, // '['
+    { 3015,  6, 13,   0,   4,  6}, // 'backslash'
+    { 3054,  4, 16,   0,   3,  5}, // ']'
+    { 3086,  7,  6,   1,   4,  9}, // '^'
+    { 3110,  7,  2,   0,  17,  6}, // '_'
+    { 3118,  4,  3,   0,   4,  5}, // '`'
+    { 3124,  8, 10,   0,   7,  8}, // 'a'
+    { 3164,  8, 12,   1,   4,  9}, // 'b'
+    { 3212,  7,  9,   0,   7,  8}, // 'c'
+    { 3248,  8, 12,   0,   4,  9}, // 'd'
+    { 3296,  8,  9,   0,   7,  8}, // 'e'
+    { 3332,  6, 12,   0,   4,  6}, // 'f'
+    { 3368,  8, 12,   0,   7,  8}, // 'g'
+    { 3416,  7, 12,   1,   4,  9}, // 'h'
+    { 3464,  2, 12,   1,   4,  4}, // 'i'
+    { 3476,  4, 15,  -1,   4,  4}, // 'j'
+    { 3506,  7, 12,   1,   4,  8}, // 'k'
+    { 3554,  2, 12,   1,   4,  4}, // 'l'
+    { 3566, 12,  9,   1,   7, 13}, // 'm'
+    { 3620,  7,  9,   1,   7,  9}, // 'n'
+    { 3656,  9,  9,   0,   7,  9}, // 'o'
+    { 3701,  8, 12,   1,   7,  9}, // 'p'
+    { 3749,  8, 12,   0,   7,  9}, // 'q'
+    { 3797,  5,  9,   1,   7,  6}, // 'r'
+    { 3824,  7, 10,   0,   7,  7}, // 's'
+    { 3864,  6, 12,   0,   5,  6}, // 't'
+    { 3900,  7,  9,   1,   8,  9}, // 'u'
+    { 3936,  8,  8,   0,   8,  8}, // 'v'
+    { 3968, 13,  8,   0,   8, 12}, // 'w'
+    { 4024,  8,  8,   0,   8,  8}, // 'x'
+    { 4056,  8, 11,   0,   8,  8}, // 'y'
+    { 4100,  7,  8,   0,   8,  8}, // 'z'
+    { 4132,  5, 16,   0,   3,  5}, // '{'
+    { 4180,  2, 16,   1,   3,  5}, // '|'
+    { 4196,  5, 16,   0,   3,  5}, // '}'
+    { 4244,  8,  4,   1,   9,  9}, // '~'
+};
+
+const MLCD_FontDesc_t mlcd_font_aa16 = {
+    .bitmap = mlcd_font_aa16_bitmap,
+    .glyphs = mlcd_font_aa16_glyphs,
+    .first = 0x20,
+    .last = 0x7E,
+    .height = 20,
+};
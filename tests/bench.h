@@ -0,0 +1,20 @@
+//
+// 主机基准测试的计时工具 (只在 tests/ 中使用)
+//
+
+#ifndef MLCD_DRIVER_BENCH_H
+#define MLCD_DRIVER_BENCH_H
+
+#include <time.h>
+
+// 单调时钟 (秒)
+static inline double Bench_Seconds(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+// 防止被测结果被优化掉
+static volatile long bench_sink;
+
+#endif //MLCD_DRIVER_BENCH_H
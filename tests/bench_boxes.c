@@ -0,0 +1,82 @@
+//
+// 方块碰撞粗筛耗时：Boxes_Step (少量方块逐对、其余走均匀网格) 与全部逐对检查的单步耗时随方块数的变化
+// 白盒测试：直接包含 animation.c
+//
+
+#include "../Src/animation.c"
+#include "bench.h"
+#include <stdio.h>
+
+// 参照：所有方块对都经过同一窄相 (Boxes_Collide)，积分与边界处理与 Boxes_Step 相同
+static void Boxes_StepBrute(void) {
+    for (int i = 0; i < box_count; i++) {
+        box_vx0[i] = boxes[i].dx;
+        box_vy0[i] = boxes[i].dy;
+        box_toi[i] = BOX_TOI_ONE;
+    }
+    for (int a = 0; a < box_count; a++) {
+        int ax0, ay0, ax1, ay1;
+        Box_SweptBounds(a, &ax0, &ay0, &ax1, &ay1);
+        for (int b = a + 1; b < box_count; b++) {
+            int bx0, by0, bx1, by1;
+            Box_SweptBounds(b, &bx0, &by0, &bx1, &by1);
+            if (ax1 < bx0 || bx1 < ax0 || ay1 < by0 || by1 < ay0) continue;
+            Boxes_Collide(a, b);
+        }
+    }
+    for (int i = 0; i < box_count; i++) {
+        Box *b = &boxes[i];
+        b->x += (box_vx0[i] * box_toi[i]) >> BOX_FRAC_BITS;
+        b->y += (box_vy0[i] * box_toi[i]) >> BOX_FRAC_BITS;
+        int32_t max_x = (MLCD_WIDTH - 1 - b->size) << BOX_FRAC_BITS;
+        int32_t max_y = (MLCD_HEIGHT - 1 - b->size) << BOX_FRAC_BITS;
+        if (b->x <= 0) { b->x = 0; if (b->dx < 0) b->dx = -b->dx; }
+        else if (b->x >= max_x) { b->x = max_x; if (b->dx > 0) b->dx = -b->dx; }
+        if (b->y <= 0) { b->y = 0; if (b->dy < 0) b->dy = -b->dy; }
+        else if (b->y >= max_y) { b->y = max_y; if (b->dy > 0) b->dy = -b->dy; }
+    }
+}
+
+// 重叠超过 1 像素的方块对数 (衡量分离效果)
+static int Boxes_DeepOverlaps(void) {
+    int n = 0;
+    for (int i = 0; i < box_count; i++) {
+        for (int j = i + 1; j < box_count; j++) {
+            const Box *a = &boxes[i], *b = &boxes[j];
+            int32_t sa = a->size << BOX_FRAC_BITS, sb = b->size << BOX_FRAC_BITS;
+            if (a->x + BOX_TOI_ONE < b->x + sb && a->x + sa > b->x + BOX_TOI_ONE &&
+                a->y + BOX_TOI_ONE < b->y + sb && a->y + sa > b->y + BOX_TOI_ONE) n++;
+        }
+    }
+    return n;
+}
+
+int main(void)
+{
+    static const int counts[] = {5, 16, 24, 50, 100, 150, 200, BOX_MAX};
+    const int steps = 2000, settle = 200;
+
+    printf("boxes | Boxes_Step us | all pairs us | deep overlaps/step\n");
+    for (size_t k = 0; k < sizeof(counts) / sizeof(counts[0]); k++) {
+        Animation_Boxes_SetCount(counts[k]);
+        double t0 = Bench_Seconds();
+        for (int s = 0; s < steps; s++) Boxes_Step();
+        double t_step = (Bench_Seconds() - t0) * 1e6 / steps;
+
+        long overlaps = 0;
+        for (int s = 0; s < settle; s++) {
+            Boxes_Step();
+            overlaps += Boxes_DeepOverlaps();
+        }
+
+        Animation_Boxes_SetCount(counts[k]);
+        t0 = Bench_Seconds();
+        for (int s = 0; s < steps; s++) Boxes_StepBrute();
+        double t_brute = (Bench_Seconds() - t0) * 1e6 / steps;
+
+        printf("%5d | %13.2f | %12.2f | %.3f\n", box_count, t_step, t_brute, (double)overlaps / settle);
+    }
+
+    bench_sink = boxes[0].x;
+    return 0;
+}
@@ -0,0 +1,105 @@
+//
+// 抗锯齿字体 (MLCD_DrawStringFont) 与逐像素 Bayer 阈值参考实现的输出比对，
+// 以及与 5x7 点阵字体 (MLCD_DrawString) 的每字符耗时
+//
+
+#include "mlcd.h"
+#include "mlcd_font_aa.h"
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_COUNT 100000
+#define FB_BYTES (MLCD_HEIGHT * MLCD_WIDTH / 8)
+
+static const char *const bench_text = "Settings Display 128";
+
+/**
+ * @brief 参考实现：逐像素取覆盖率，level * 16 > bayer * 15 (即 level / 15 > bayer / 16) 时以 MLCD_SetPixel 写入
+ */
+static void Ref_DrawStringFont(int x, int y, const MLCD_FontDesc_t *font, const char *str, uint8_t color)
+{
+    for (int pen = x; *str; str++) {
+        uint8_t code = (uint8_t)*str;
+        if (code < font->first || code > font->last) continue;
+        const MLCD_Glyph_t *g = &font->glyphs[code - font->first];
+        const uint8_t *src = font->bitmap + g->offset;
+        int stride = (g->w + 1) / 2;
+        for (int gy = 0; gy < g->h; gy++) {
+            for (int gx = 0; gx < g->w; gx++) {
+                int sx = pen + g->x_ofs + gx, sy = y + g->y_ofs + gy;
+                if (sx < 0 || sx >= MLCD_WIDTH || sy < 0 || sy >= MLCD_HEIGHT) continue;
+                int level = (src[gy * stride + gx / 2] >> (4 * (gx % 2))) & 0x0F;
+                if (level * 16 > mlcd_bayer4x4[sy % 4][sx % 4] * 15) MLCD_SetPixel(sx, sy, color);
+            }
+        }
+        pen += g->advance;
+    }
+}
+
+int main(void)
+{
+    static uint8_t ref[FB_BYTES], out[FB_BYTES];
+    static const MLCD_FontDesc_t *const fonts[] = {&mlcd_font_aa12, &mlcd_font_aa16};
+    static const char *const texts[] = {"Settings Display 128", "AVWgjpqy|@%&{}", "!\"#$'()*+,-./:;<=>?[\\]^_`~"};
+    int bad = 0;
+
+    // 1. 输出比对：所有字符、所有 x 偏移 (含左右裁剪)、y 相位、两种颜色，背景为随机内容
+    for (int f = 0; f < 2; f++) {
+        for (int t = 0; t < 3; t++) {
+            for (int x = -40; x < MLCD_WIDTH; x++) {
+                int y = (x & 15) - 4;
+                uint8_t color = (uint8_t)(x & 1);
+                uint8_t *fb = MLCD_GetBufferPtr();
+                for (int i = 0; i < FB_BYTES; i++) fb[i] = (uint8_t)(i * 37 + x);
+
+                Ref_DrawStringFont(x, y, fonts[f], texts[t], color);
+                MLCD_CopyBuffer(ref);
+                for (int i = 0; i < FB_BYTES; i++) fb[i] = (uint8_t)(i * 37 + x);
+                MLCD_DrawStringFont(x, y, 1000, fonts[f], texts[t], color);
+                MLCD_CopyBuffer(out);
+
+                if (memcmp(ref, out, FB_BYTES) != 0) {
+                    if (bad < 5) printf("mismatch: font %d \"%s\" x %d y %d\n", f, texts[t], x, y);
+                    bad++;
+                }
+            }
+        }
+    }
+
+    // 2. 耗时：两种字体交替计时，取 15 轮中的最好成绩；x 每次移动 1 像素，覆盖所有字节内偏移
+    int chars = (int)strlen(bench_text);
+    long sum = 0;
+    double best_bitmap = 1e9, best_aa = 1e9;
+    for (int round = 0; round < 15; round++) {
+        double t0 = Bench_Seconds();
+        for (int i = 0; i < BENCH_COUNT; i++) {
+            MLCD_DrawString((uint8_t)(i & 7), (uint8_t)(i & 63), bench_text, (uint8_t)(i & 1));
+        }
+        double t1 = Bench_Seconds();
+        for (int i = 0; i < BENCH_COUNT; i++) {
+            sum += MLCD_DrawStringFont(i & 7, i & 63, MLCD_WIDTH, &mlcd_font_aa12, bench_text, (uint8_t)(i & 1));
+        }
+        double t2 = Bench_Seconds();
+        if (t1 - t0 < best_bitmap) best_bitmap = t1 - t0;
+        if (t2 - t1 < best_aa) best_aa = t2 - t1;
+    }
+    bench_sink = sum + MLCD_GetBufferPtr()[5];
+
+    // 每字符的字模面积：5x7 固定 35 像素，aa12 取各字形包围盒的平均值
+    int aa_area = 0;
+    for (const char *c = bench_text; *c; c++) {
+        const MLCD_Glyph_t *g = &mlcd_font_aa12.glyphs[(uint8_t)*c - mlcd_font_aa12.first];
+        aa_area += g->w * g->h;
+    }
+    double px_bitmap = MLCD_FONT_WIDTH * MLCD_FONT_HEIGHT, px_aa = (double)aa_area / chars;
+
+    double ns_bitmap = best_bitmap * 1e9 / ((double)BENCH_COUNT * chars);
+    double ns_aa = best_aa * 1e9 / ((double)BENCH_COUNT * chars);
+    printf("5x7 bitmap (MLCD_DrawString):   %6.1f ns/char, %4.1f px/char, %5.2f ns/px\n",
+           ns_bitmap, px_bitmap, ns_bitmap / px_bitmap);
+    printf("aa12 (MLCD_DrawStringFont):     %6.1f ns/char, %4.1f px/char, %5.2f ns/px (%.2fx bitmap per char)\n",
+           ns_aa, px_aa, ns_aa / px_aa, ns_aa / ns_bitmap);
+    printf("%d output mismatches\n", bad);
+    return bad != 0;
+}
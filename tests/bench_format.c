@@ -0,0 +1,57 @@
+//
+// MLCD_FormatInt / MLCD_FormatNumber 与 sprintf 的输出比对和耗时
+//
+
+#include "mlcd.h"
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#define BENCH_COUNT 5000000
+
+int main(void)
+{
+    char a[32], b[32];
+    int bad = 0;
+
+    // 1. 输出比对 (含 INT32_MIN / INT32_MAX 与填充、符号、单位)
+    static const int32_t values[] = {0, 1, -1, 9, 10, -10, 99, 100, 123, -456, 5, -5,
+                                     INT32_MAX, INT32_MIN};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        long v = values[i];
+        int n = MLCD_FormatInt(a, sizeof(a), values[i]);
+        int m = sprintf(b, "%ld", v);
+        if (n != m || strcmp(a, b) != 0) { printf("int %ld: \"%s\" vs \"%s\"\n", v, a, b); bad++; }
+
+        n = MLCD_FormatNumber(a, sizeof(a), values[i], 0, 6, MLCD_FMT_ZERO | MLCD_FMT_SIGN, "ms");
+        m = sprintf(b, "%+06ldms", v);
+        if (n != m || strcmp(a, b) != 0) { printf("zero/sign %ld: \"%s\" vs \"%s\"\n", v, a, b); bad++; }
+
+        n = MLCD_FormatNumber(a, sizeof(a), values[i], 0, 6, 0, NULL);
+        m = sprintf(b, "%6ld", v);
+        if (n != m || strcmp(a, b) != 0) { printf("width %ld: \"%s\" vs \"%s\"\n", v, a, b); bad++; }
+    }
+
+    // 2. 耗时
+    long sum = 0;
+    double t0 = Bench_Seconds();
+    for (int i = 0; i < BENCH_COUNT; i++) sum += sprintf(b, "%ld", (long)i * 7 - BENCH_COUNT);
+    double t1 = Bench_Seconds();
+    for (int i = 0; i < BENCH_COUNT; i++) sum += MLCD_FormatInt(a, sizeof(a), i * 7 - BENCH_COUNT);
+    double t2 = Bench_Seconds();
+    for (int i = 0; i < BENCH_COUNT; i++) sum += sprintf(b, "%+06ldms", (long)i * 7 - BENCH_COUNT);
+    double t3 = Bench_Seconds();
+    for (int i = 0; i < BENCH_COUNT; i++) {
+        sum += MLCD_FormatNumber(a, sizeof(a), i * 7 - BENCH_COUNT, 0, 6, MLCD_FMT_ZERO | MLCD_FMT_SIGN, "ms");
+    }
+    double t4 = Bench_Seconds();
+    bench_sink = sum;
+
+    printf("%%ld:      sprintf %6.1f ns, MLCD_FormatInt    %6.1f ns\n",
+           (t1 - t0) * 1e9 / BENCH_COUNT, (t2 - t1) * 1e9 / BENCH_COUNT);
+    printf("%%+06ldms: sprintf %6.1f ns, MLCD_FormatNumber %6.1f ns\n",
+           (t3 - t2) * 1e9 / BENCH_COUNT, (t4 - t3) * 1e9 / BENCH_COUNT);
+    printf("%d output mismatches\n", bad);
+    return bad != 0;
+}
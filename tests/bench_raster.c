@@ -0,0 +1,54 @@
+//
+// 填充渲染器耗时：随机三角形填充速率与三个演示网格的整帧渲染时间
+// 白盒测试：直接包含 animation.c
+//
+
+#include "../Src/animation.c"
+#include "bench.h"
+#include <stdio.h>
+
+#define TRIANGLES 4096
+
+int main(void)
+{
+    // 1. 随机三角形 (外接约 20px)，密度轮流取 0~15
+    static Point2D tri[TRIANGLES][3];
+    srand(1);
+    for (int i = 0; i < TRIANGLES; i++) {
+        int cx = rand() % MLCD_WIDTH, cy = rand() % MLCD_HEIGHT;
+        for (int k = 0; k < 3; k++) {
+            tri[i][k].x = cx + rand() % 21 - 10;
+            tri[i][k].y = cy + rand() % 21 - 10;
+        }
+    }
+    const int rounds = 200;
+    double t0 = Bench_Seconds();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < TRIANGLES; i++) Raster_FillConvex(tri[i], 3, (uint8_t)(i & 15));
+    }
+    double t = Bench_Seconds() - t0;
+    printf("random ~20px triangles: %.2f M triangles/s\n", (double)rounds * TRIANGLES / t / 1e6);
+
+    // 2. 演示网格的填充帧 (清屏 + 旋转投影 + 排序 + 填充)
+    static const struct { const char *name; const Mesh_t *mesh; float scale; } demos[] = {
+        {"cube", &mesh_cube, 30.0f},
+        {"pyramid", &mesh_pyramid, 40.0f},
+        {"sphere", &mesh_sphere, 45.0f},
+    };
+    Animation3D_SetRenderMode(RENDER3D_FILLED);
+    for (size_t k = 0; k < sizeof(demos) / sizeof(demos[0]); k++) {
+        const int frames = 20000;
+        t0 = Bench_Seconds();
+        for (int f = 0; f < frames; f++) {
+            angle_x = f * 0.01f;
+            angle_y = f * 0.02f;
+            angle_z = 0.2f;
+            MLCD_ClearBuffer();
+            ProjectAndDraw(demos[k].mesh, demos[k].scale);
+        }
+        t = Bench_Seconds() - t0;
+        printf("%-8s filled frame: %6.2f us\n", demos[k].name, t * 1e6 / frames);
+    }
+    bench_sink = MLCD_GetBufferPtr()[0];
+    return 0;
+}
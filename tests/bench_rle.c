@@ -0,0 +1,113 @@
+//
+// RLE 图片与未压缩图片的 Flash 占用、绘制结果比对和绘制耗时
+// 每个 RLE 位图先用独立的参考解码器展开为未压缩行，再分别用 MLCD_DrawImage 绘制
+//
+
+#include "mlcd.h"
+#include "mlcd_assets.h"
+#include "bench.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_BITMAPS 64
+#define RAW_MAX     (MLCD_HEIGHT * MLCD_WIDTH / 8)
+
+/**
+ * @brief 参考解码：黑白交替游程 (从 0 开始)，4bit 半字节长度，15 表示续接
+ * @return 压缩数据字节数
+ */
+static int Ref_DecodeRle(const MLCD_Bitmap_t *bmp, uint8_t *raw)
+{
+    int total = bmp->w * bmp->h, pos = 0, nibble = 0, color = 0;
+    memset(raw, 0, (size_t)bmp->stride * bmp->h);
+    while (pos < total) {
+        int len = 0, v;
+        do {
+            uint8_t byte = bmp->data[nibble >> 1];
+            v = (nibble & 1) ? (byte & 0x0F) : (byte >> 4);
+            nibble++;
+            len += v;
+        } while (v == 15);
+        for (int i = 0; i < len && pos < total; i++, pos++) {
+            if (color) raw[(pos / bmp->w) * bmp->stride + (pos % bmp->w) / 8] |= (uint8_t)(1 << (pos % bmp->w % 8));
+        }
+        color ^= 1;
+    }
+    return (nibble + 1) / 2;
+}
+
+static const MLCD_Bitmap_t *rle[MAX_BITMAPS];
+static MLCD_Bitmap_t raw[MAX_BITMAPS];
+static uint8_t raw_data[MAX_BITMAPS][RAW_MAX];
+static int count;
+
+static void Add_Bitmap(const MLCD_Bitmap_t *bmp)
+{
+    if (bmp->encoding != MLCD_ENC_RLE || count >= MAX_BITMAPS) return;
+    rle[count] = bmp;
+    raw[count] = *bmp;
+    raw[count].data = raw_data[count];
+    raw[count].encoding = MLCD_ENC_RAW;
+    count++;
+}
+
+// 在一组位置上绘制全部位图 (包含上下左右裁剪)
+static void Draw_All(const MLCD_Bitmap_t *list, const MLCD_Bitmap_t *const *plist)
+{
+    for (int y = -40; y < MLCD_HEIGHT + 2; y += 7) {
+        for (int x = -40; x < MLCD_WIDTH + 2; x += 5) {
+            for (int i = 0; i < count; i++) {
+                MLCD_DrawImage(x, y, list ? &list[i] : plist[i], MLCD_COLOR_BLACK);
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    const MLCD_Asset_t *icons[] = {&icon_damping, &icon_display, &icon_theme};
+    for (size_t a = 0; a < sizeof(icons) / sizeof(icons[0]); a++) {
+        Add_Bitmap(&icons[a]->base);
+        for (int s = 0; s < icons[a]->scaled_count; s++) Add_Bitmap(&icons[a]->scaled[s]);
+    }
+    Add_Bitmap(&image_splash);
+
+    // 1. Flash 占用
+    int rle_bytes = 0, raw_bytes = 0;
+    for (int i = 0; i < count; i++) {
+        rle_bytes += Ref_DecodeRle(rle[i], raw_data[i]);
+        raw_bytes += rle[i]->stride * rle[i]->h;
+    }
+    printf("%d RLE bitmaps: %d bytes (raw %d bytes, %.1f%%)\n",
+           count, rle_bytes, raw_bytes, 100.0 * rle_bytes / raw_bytes);
+
+    // 2. 逐位置比对
+    static uint8_t expect[RAW_MAX];
+    long cases = 0, bad = 0;
+    for (int i = 0; i < count; i++) {
+        for (int y = -40; y < MLCD_HEIGHT + 2; y += 7) {
+            for (int x = -40; x < MLCD_WIDTH + 2; x += 5) {
+                MLCD_ClearBuffer();
+                MLCD_DrawImage(x, y, &raw[i], MLCD_COLOR_BLACK);
+                memcpy(expect, MLCD_GetBufferPtr(), RAW_MAX);
+                MLCD_ClearBuffer();
+                MLCD_DrawImage(x, y, rle[i], MLCD_COLOR_BLACK);
+                cases++;
+                if (memcmp(expect, MLCD_GetBufferPtr(), RAW_MAX) != 0) bad++;
+            }
+        }
+    }
+    printf("%ld draws compared, %ld mismatches\n", cases, bad);
+
+    // 3. 绘制耗时
+    const int rounds = 20;
+    double t0 = Bench_Seconds();
+    for (int r = 0; r < rounds; r++) Draw_All(raw, NULL);
+    double t1 = Bench_Seconds();
+    for (int r = 0; r < rounds; r++) Draw_All(NULL, rle);
+    double t2 = Bench_Seconds();
+    bench_sink = MLCD_GetBufferPtr()[0];
+    printf("draw: raw %.2f s, RLE %.2f s (%.2fx)\n", t1 - t0, t2 - t1, (t2 - t1) / (t1 - t0));
+
+    return bad != 0;
+}
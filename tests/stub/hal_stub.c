@@ -0,0 +1,32 @@
+//
+// 主机测试用 HAL 桩实现
+//
+
+#include "stm32f4xx_hal.h"
+#include <stdbool.h>
+
+GPIO_TypeDef stub_gpioa, stub_gpioc, stub_gpioe;
+SPI_HandleTypeDef hspi1;
+TIM_HandleTypeDef htim1, htim5;
+DWT_Type stub_dwt;
+CoreDebug_Type stub_coredebug;
+uint32_t SystemCoreClock = 168000000;
+
+// menu.c 中的设置项 (animation.c 读取)，主机测试不链接 menu.c
+bool setting_dark_mode = false;
+
+static uint32_t tick;
+
+uint32_t HAL_GetTick(void) { return tick++; }
+void HAL_Delay(uint32_t delay) { tick += delay; }
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) { (void)port; (void)pin; (void)state; }
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin) { (void)port; (void)pin; return GPIO_PIN_SET; }
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *data, uint16_t size, uint32_t timeout)
+{
+    (void)hspi; (void)data; (void)size; (void)timeout;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t channel) { (void)htim; (void)channel; return HAL_OK; }
+HAL_StatusTypeDef HAL_TIM_Encoder_Start(TIM_HandleTypeDef *htim, uint32_t channel) { (void)htim; (void)channel; return HAL_OK; }
@@ -0,0 +1,53 @@
+//
+// 主机测试用 HAL 桩：只提供可移植模块 (mlcd / animation / frame_clock ...) 用到的类型和函数，
+// 外设操作全部为空，DWT 周期计数器固定不动 (FrameClock_Micros 恒为 0)
+//
+
+#ifndef MLCD_DRIVER_STM32F4XX_HAL_STUB_H
+#define MLCD_DRIVER_STM32F4XX_HAL_STUB_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct { int dummy; } SPI_HandleTypeDef;
+typedef struct { int dummy; } TIM_HandleTypeDef;
+typedef struct { int dummy; } GPIO_TypeDef;
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+typedef enum { HAL_OK = 0, HAL_ERROR } HAL_StatusTypeDef;
+
+extern GPIO_TypeDef stub_gpioa, stub_gpioc, stub_gpioe;
+#define GPIOA (&stub_gpioa)
+#define GPIOC (&stub_gpioc)
+#define GPIOE (&stub_gpioe)
+#define GPIO_PIN_4  0x0010
+#define GPIO_PIN_6  0x0040
+#define GPIO_PIN_8  0x0100
+#define GPIO_PIN_13 0x2000
+
+#define TIM_CHANNEL_1   0x00
+#define TIM_CHANNEL_4   0x0C
+#define TIM_CHANNEL_ALL 0x3C
+#define __HAL_TIM_GET_COUNTER(h) 0u
+#define __NOP() do {} while (0)
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t delay);
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t channel);
+HAL_StatusTypeDef HAL_TIM_Encoder_Start(TIM_HandleTypeDef *htim, uint32_t channel);
+
+// Cortex-M4 DWT 周期计数器
+typedef struct { volatile uint32_t CTRL, CYCCNT; } DWT_Type;
+typedef struct { volatile uint32_t DEMCR; } CoreDebug_Type;
+extern DWT_Type stub_dwt;
+extern CoreDebug_Type stub_coredebug;
+#define DWT       (&stub_dwt)
+#define CoreDebug (&stub_coredebug)
+#define CoreDebug_DEMCR_TRCENA_Msk (1u << 24)
+#define DWT_CTRL_CYCCNTENA_Msk     1u
+
+extern uint32_t SystemCoreClock;
+
+#endif //MLCD_DRIVER_STM32F4XX_HAL_STUB_H
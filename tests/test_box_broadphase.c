@@ -0,0 +1,65 @@
+//
+// 方块碰撞粗筛 (Boxes_BroadPhase：均匀网格 + 交集左上角单元去重) 与全部方块对的逐对检查比对：
+// 候选对必须恰好是扫掠包围盒相交的方块对，每对只出现一次
+// 白盒测试：直接包含 animation.c
+//
+
+#include "../Src/animation.c"
+#include <stdio.h>
+
+static uint8_t pair_seen[BOX_MAX][BOX_MAX]; // [a][b] (a < b) 本步被报告的次数
+static long bad_order;
+
+static void Record_Pair(int a, int b)
+{
+    if (a >= b) { bad_order++; int t = a; a = b; b = t; }
+    if (pair_seen[a][b] < 255) pair_seen[a][b]++;
+}
+
+int main(void)
+{
+    static const int counts[] = {5, 16, BOX_GRID_MIN, 50, 100, 150, 200, BOX_MAX};
+    const int steps = 300;
+    long pairs = 0, missed = 0, extra = 0, duplicate = 0;
+
+    for (size_t k = 0; k < sizeof(counts) / sizeof(counts[0]); k++) {
+        Animation_Boxes_SetCount(counts[k]);
+        for (int s = 0; s < steps; s++) {
+            // 与 Boxes_Step 相同：粗筛使用本步开始时的速度
+            for (int i = 0; i < box_count; i++) {
+                box_vx0[i] = boxes[i].dx;
+                box_vy0[i] = boxes[i].dy;
+            }
+            memset(pair_seen, 0, sizeof(pair_seen));
+            Boxes_BroadPhase(Record_Pair);
+
+            for (int a = 0; a < box_count; a++) {
+                int ax0, ay0, ax1, ay1;
+                Box_SweptBounds(a, &ax0, &ay0, &ax1, &ay1);
+                for (int b = a + 1; b < box_count; b++) {
+                    int bx0, by0, bx1, by1;
+                    Box_SweptBounds(b, &bx0, &by0, &bx1, &by1);
+                    bool overlap = !(ax1 < bx0 || bx1 < ax0 || ay1 < by0 || by1 < ay0);
+                    int seen = pair_seen[a][b];
+                    pairs += overlap;
+
+                    if ((overlap && seen != 1) || (!overlap && seen != 0)) {
+                        if (missed + extra + duplicate < 5) {
+                            printf("boxes %d step %d: pair (%d, %d) overlap %d reported %d times\n",
+                                   box_count, s, a, b, overlap, seen);
+                        }
+                    }
+                    if (overlap && seen == 0) missed++;
+                    if (!overlap && seen) extra++;
+                    if (seen > 1) duplicate++;
+                }
+            }
+
+            Boxes_Step();
+        }
+    }
+
+    printf("%ld overlapping pairs: %ld missed, %ld extra, %ld duplicate, %ld out of order\n",
+           pairs, missed, extra, duplicate, bad_order);
+    return (missed || extra || duplicate || bad_order) ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+//
+// 溶解过渡 (Transition_ComposeRow + bayer_masks) 与逐像素 Bayer 参考实现的逐位比对
+// 白盒测试：直接包含 animation.c
+//
+
+#include "../Src/animation.c"
+#include <stdio.h>
+
+#define ROW_BYTES (MLCD_WIDTH / 8)
+
+static const uint8_t ref_bayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+/**
+ * @brief 参考实现：按位查 Bayer 矩阵的原溶解规则
+ * 只有在任一帧中为内容色 (浅色模式 0 / 深色模式 1) 的像素才按阈值切换，纯背景像素取新页面
+ */
+static uint8_t Ref_Dissolve(int y, int col, uint8_t old_byte, uint8_t new_byte, int threshold, bool dark)
+{
+    uint8_t out = 0;
+    for (int bit = 0; bit < 8; bit++) {
+        int x = col * 8 + bit;
+        int old_pixel = (old_byte >> bit) & 1;
+        int new_pixel = (new_byte >> bit) & 1;
+        bool content = dark ? (old_pixel || new_pixel) : (!old_pixel || !new_pixel);
+        int pixel = new_pixel;
+        if (content && threshold <= ref_bayer[y % 4][x % 4]) pixel = old_pixel;
+        if (pixel) out |= (uint8_t)(1 << bit);
+    }
+    return out;
+}
+
+int main(void)
+{
+    static uint8_t new_frame[MLCD_HEIGHT][ROW_BYTES];
+    uint8_t row[ROW_BYTES];
+    long rows = 0, mismatches = 0;
+
+    srand(3);
+    transition_type = TRANSITION_DISSOLVE;
+    transition_dir = TRANSITION_DIR_FORWARD;
+
+    for (int frame = 0; frame < 500; frame++) {
+        // 一半为完全随机的两帧，一半为只有少量像素不同的两帧 (接近实际的页面切换)
+        for (int y = 0; y < MLCD_HEIGHT; y++) {
+            for (int c = 0; c < ROW_BYTES; c++) {
+                old_page_buffer[y][c] = (uint8_t)rand();
+                new_frame[y][c] = (frame & 1) ? (uint8_t)rand()
+                                              : (uint8_t)(old_page_buffer[y][c] ^ (rand() & rand()));
+            }
+        }
+
+        // 每个阈值取区间中点作为进度，另加进度 1.0 (阈值被截到 16)
+        for (int t = 0; t <= 17; t++) {
+            transition_progress = (t < 17) ? (t + 0.5f) / 17.0f : 1.0f;
+            int threshold = (t < 17) ? t : 16;
+
+            for (int y = 0; y < MLCD_HEIGHT; y++) {
+                Transition_ComposeRow(y, &new_frame[0][0], row);
+                rows++;
+                for (int c = 0; c < ROW_BYTES; c++) {
+                    uint8_t light = Ref_Dissolve(y, c, old_page_buffer[y][c], new_frame[y][c], threshold, false);
+                    uint8_t dark = Ref_Dissolve(y, c, old_page_buffer[y][c], new_frame[y][c], threshold, true);
+                    if (row[c] != light || row[c] != dark) {
+                        if (mismatches++ < 5) {
+                            printf("mismatch: frame %d threshold %d y %d col %d: %02X (ref %02X / %02X)\n",
+                                   frame, threshold, y, c, row[c], light, dark);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    printf("%ld rows, %ld mismatches\n", rows, mismatches);
+    return mismatches != 0;
+}
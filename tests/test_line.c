@@ -0,0 +1,128 @@
+//
+// MLCD_DrawLine / MLCD_DrawLineDither 与逐像素 Bresenham 参考实现的逐字节比对
+// 白盒测试：直接包含 mlcd.c，参考实现使用同一个 ClipLine，只替换画线内核
+//
+
+#include "../Src/mlcd.c"
+#include <stdio.h>
+
+#define ROW_BYTES (MLCD_WIDTH / 8)
+
+static uint8_t background[MLCD_HEIGHT][ROW_BYTES];
+static uint8_t reference[MLCD_HEIGHT][ROW_BYTES];
+static long line_count, mismatch_count;
+
+// 4x4 Bayer 矩阵 (与 dither_bayer 相同，单独写一份作为参考)
+static const uint8_t ref_bayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+/**
+ * @brief 参考实现：字节内核之前的逐像素对称 Bresenham
+ * @param density 0~15 为抖动密度，16 为实线
+ */
+static void Ref_DrawLine(int x0, int y0, int x1, int y1, uint8_t color, int density)
+{
+    if (!ClipLine(&x0, &y0, &x1, &y1)) return;
+
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy, e2;
+
+    for (;;) {
+        if (density >= 16 || ref_bayer[y0 & 3][x0 & 3] < density) {
+            uint8_t bit = (uint8_t)(1 << (x0 & 7));
+            if (color == MLCD_COLOR_WHITE) reference[y0][x0 >> 3] |= bit;
+            else reference[y0][x0 >> 3] &= (uint8_t)~bit;
+        }
+        if (x0 == x1 && y0 == y1) break;
+        e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+/**
+ * @brief 画一条线并与参考实现比对，随后把两块缓冲恢复为背景
+ * 先比对线条所在的行，再比对整屏 (检查行外没有被写入)
+ */
+static void Check_Line(int x0, int y0, int x1, int y1, uint8_t color, int density)
+{
+    Ref_DrawLine(x0, y0, x1, y1, color, density);
+    if (density >= 16) MLCD_DrawLine(x0, y0, x1, y1, color);
+    else MLCD_DrawLineDither(x0, y0, x1, y1, color, (uint8_t)density);
+    line_count++;
+
+    int top = y0 < y1 ? y0 : y1, bottom = y0 < y1 ? y1 : y0;
+    if (top < 0) top = 0;
+    if (bottom > MLCD_HEIGHT - 1) bottom = MLCD_HEIGHT - 1;
+    if (top <= bottom) {
+        size_t len = (size_t)(bottom - top + 1) * ROW_BYTES;
+        if (memcmp(reference[top], mlcd_buffer[top], len) != 0) {
+            if (mismatch_count++ < 5) {
+                printf("mismatch: (%d,%d)-(%d,%d) color %d density %d\n", x0, y0, x1, y1, color, density);
+            }
+        }
+        memcpy(reference[top], background[top], len);
+        memcpy(mlcd_buffer[top], background[top], len);
+    }
+    if (memcmp(reference, mlcd_buffer, sizeof(reference)) != 0) {
+        if (mismatch_count++ < 5) {
+            printf("write outside line rows: (%d,%d)-(%d,%d)\n", x0, y0, x1, y1);
+        }
+        memcpy(reference, background, sizeof(background));
+        memcpy(mlcd_buffer, background, sizeof(background));
+    }
+}
+
+int main(void)
+{
+    // 随机背景，黑白两种颜色都能暴露多写/漏写
+    srand(7);
+    for (size_t i = 0; i < sizeof(background); i++) ((uint8_t *)background)[i] = (uint8_t)rand();
+    memcpy(reference, background, sizeof(background));
+    memcpy(mlcd_buffer, background, sizeof(background));
+
+    // 1. 实线：每个起点列 (覆盖全部字节对齐) x 4 个起点行 x 每个终点像素
+    static const int start_rows[4] = {0, 1, 77, MLCD_HEIGHT - 1};
+    long base = line_count;
+    for (int x0 = 0; x0 < MLCD_WIDTH; x0++) {
+        for (int k = 0; k < 4; k++) {
+            for (int x1 = 0; x1 < MLCD_WIDTH; x1++) {
+                for (int y1 = 0; y1 < MLCD_HEIGHT; y1++) {
+                    Check_Line(x0, start_rows[k], x1, y1, (uint8_t)((x1 ^ y1) & 1), 16);
+                }
+            }
+        }
+    }
+    printf("solid:   %ld lines\n", line_count - base);
+
+    // 2. 抖动线：密度 1~15，16 个起点到每个终点像素
+    base = line_count;
+    for (int d = 1; d < 16; d++) {
+        for (int s = 0; s < 16; s++) {
+            for (int x1 = 0; x1 < MLCD_WIDTH; x1++) {
+                for (int y1 = 0; y1 < MLCD_HEIGHT; y1++) {
+                    Check_Line((s * 37) & 127, (s * 53) & 127, x1, y1, (uint8_t)(s & 1), d);
+                }
+            }
+        }
+    }
+    printf("dither:  %ld lines\n", line_count - base);
+
+    // 3. 需要裁剪的线：端点在 [-200, 327] 内随机
+    base = line_count;
+    for (int i = 0; i < 4000000; i++) {
+        int x0 = rand() % 528 - 200, y0 = rand() % 528 - 200;
+        int x1 = rand() % 528 - 200, y1 = rand() % 528 - 200;
+        int density = (i % 3) ? 16 : 1 + rand() % 15;
+        Check_Line(x0, y0, x1, y1, (uint8_t)(rand() & 1), density);
+    }
+    printf("clipped: %ld lines\n", line_count - base);
+
+    printf("%ld lines, %ld mismatches\n", line_count, mismatch_count);
+    return mismatch_count != 0;
+}
@@ -0,0 +1,100 @@
+//
+// 粒子系统：静态碰撞矩形下长时间推进，检查每一步所有粒子都在屏幕左右墙与地面之内 (顶部敞开)、
+// 不停留在任何碰撞矩形内部；MLCD_DrawPoints 与逐点 MLCD_SetPixel 的绘制结果逐位比对
+// 白盒测试：直接包含 animation.c
+//
+
+#include "../Src/animation.c"
+#include <stdio.h>
+
+#define FB_BYTES (MLCD_HEIGHT * MLCD_WIDTH / 8)
+
+static int failures;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { if (failures < 10) { printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } failures++; } \
+    } while (0)
+
+// 静态碰撞矩形：悬空的平台、贴地的方块、贴左右墙的方块、细长的柱子
+static const ParticleCollider_t test_rects[] = {
+    { 20, 40, 30, 6 },
+    { 70, 30, 12, 12 },
+    { 100, 100, 20, 28 },
+    { 0, 80, 10, 10 },
+    { 118, 60, 10, 10 },
+    { 56, 70, 2, 40 },
+    { 30, 110, 16, 8 },
+};
+#define TEST_RECTS (int)(sizeof(test_rects) / sizeof(test_rects[0]))
+
+// 粒子 i 所在像素是否在某个碰撞矩形内
+static int Inside_Rect(int i)
+{
+    int sx = particles.x[i] >> PARTICLE_FRAC_BITS, sy = particles.y[i] >> PARTICLE_FRAC_BITS;
+    for (int k = 0; k < TEST_RECTS; k++) {
+        const ParticleCollider_t *r = &test_rects[k];
+        if (sx >= r->x && sx < r->x + r->w && sy >= r->y && sy < r->y + r->h) return k;
+    }
+    return -1;
+}
+
+// 逐点 MLCD_SetPixel 绘制与 MLCD_DrawPoints 比对 (两种颜色，背景为随机内容)
+static void Check_Draw(int step)
+{
+    static uint8_t ref[FB_BYTES], out[FB_BYTES];
+    for (int color = 0; color < 2; color++) {
+        uint8_t *fb = MLCD_GetBufferPtr();
+        for (int b = 0; b < FB_BYTES; b++) fb[b] = (uint8_t)rand();
+        MLCD_CopyBuffer(ref);
+
+        for (int i = 0; i < particles.count; i++) {
+            int x = particles.x[i] >> PARTICLE_FRAC_BITS, y = particles.y[i] >> PARTICLE_FRAC_BITS;
+            if (x >= 0 && x < MLCD_WIDTH && y >= 0 && y < MLCD_HEIGHT) MLCD_SetPixel(x, y, (uint8_t)color);
+        }
+        MLCD_CopyBuffer(out);
+        MLCD_SetBuffer(ref);
+        Animation_Particles_Draw((uint8_t)color);
+        MLCD_CopyBuffer(ref);
+        CHECK(memcmp(ref, out, FB_BYTES) == 0, "step %d color %d: MLCD_DrawPoints differs from MLCD_SetPixel", step, color);
+    }
+}
+
+int main(void)
+{
+    srand(7);
+    Animation_Particles_Clear();
+    Animation_Particles_SetPhysics(0.03f, 0.6f);
+    Animation_Particles_SetColliders(test_rects, TEST_RECTS);
+
+    // 喷口都在矩形之外；速度覆盖慢速落下、高速斜射与撞墙
+    static const float emitters[][4] = {
+        { 8.0f, 120.0f, 1.5f, -2.8f },
+        { 64.0f, 125.0f, 0.0f, -3.2f },
+        { 90.0f, 10.0f, -1.0f, 0.0f },
+        { 120.0f, 20.0f, -2.5f, -1.0f },
+        { 40.0f, 60.0f, 0.3f, -0.5f },
+    };
+    const int steps = 4000;
+    long checked = 0, peak = 0;
+
+    for (int s = 0; s < steps; s++) {
+        const float *e = emitters[s % 5];
+        Animation_Particles_Emit(12, e[0], e[1], e[2], e[3], 1.2f, 200);
+        Animation_Particles_Step();
+
+        for (int i = 0; i < particles.count; i++) {
+            int32_t x = particles.x[i], y = particles.y[i];
+            CHECK(x >= 0 && x <= PARTICLE_EDGE, "step %d: particle %d x %.2f outside the walls", s, i, x / 256.0);
+            CHECK(y <= PARTICLE_FLOOR, "step %d: particle %d y %.2f below the floor", s, i, y / 256.0);
+            int k = Inside_Rect(i);
+            CHECK(k < 0, "step %d: particle %d at (%.2f, %.2f) v (%.2f, %.2f) inside rect %d", s, i,
+                  x / 256.0, y / 256.0, particles.vx[i] / 256.0, particles.vy[i] / 256.0, k);
+            checked++;
+        }
+        if (particles.count > peak) peak = particles.count;
+        if (s % 97 == 0) Check_Draw(s);
+    }
+
+    printf("%d steps, peak %ld particles, %ld particle-steps checked, %d failures\n", steps, peak, checked, failures);
+    return failures != 0;
+}
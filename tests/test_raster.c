@@ -0,0 +1,120 @@
+//
+// 凸多边形填充 (Raster_FillConvex + MLCD_FillSpan) 与逐像素参考实现的逐位比对
+// 白盒测试：直接包含 animation.c
+//
+
+#include "../Src/animation.c"
+#include <stdio.h>
+
+#define ROW_BYTES (MLCD_WIDTH / 8)
+
+static const uint8_t ref_bayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+// 向下取整的除法 (b > 0)
+static int64_t Ref_FloorDiv(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+    return (q * b > a) ? q - 1 : q;
+}
+
+/**
+ * @brief 参考实现：逐行用精确除法求每条边与该行的交点 x = a.x + dx * t / dy (四舍五入，0.5 取 +x)，
+ * 取所有交点的最小/最大值作为跨度，再逐像素按 Bayer 阈值写入 (bayer < density 为白)
+ */
+static void Ref_FillConvex(uint8_t *fb, const Point2D *pts, int n, int density)
+{
+    for (int y = 0; y < MLCD_HEIGHT; y++) {
+        int64_t l = INT64_MAX, r = INT64_MIN;
+        for (int k = 0; k < n; k++) {
+            Point2D a = pts[k], b = pts[(k + 1) % n];
+            if (a.y > b.y) { Point2D t = a; a = b; b = t; }
+            if (y < a.y || y > b.y) continue;
+
+            int64_t xs[2];
+            int cnt = 0;
+            if (a.y == b.y) {
+                xs[cnt++] = a.x; // 水平边：两个端点都在该行
+                xs[cnt++] = b.x;
+            } else {
+                int64_t dx = b.x - a.x, dy = b.y - a.y;
+                xs[cnt++] = a.x + Ref_FloorDiv(2 * dx * (y - a.y) + dy, 2 * dy);
+            }
+            for (int i = 0; i < cnt; i++) {
+                if (xs[i] < l) l = xs[i];
+                if (xs[i] > r) r = xs[i];
+            }
+        }
+        for (int64_t x = l; x <= r; x++) {
+            if (x < 0 || x >= MLCD_WIDTH) continue;
+            uint8_t bit = (uint8_t)(1 << (x & 7));
+            if (ref_bayer[y & 3][x & 3] < density) fb[y * ROW_BYTES + (x >> 3)] |= bit;
+            else fb[y * ROW_BYTES + (x >> 3)] &= (uint8_t)~bit;
+        }
+    }
+}
+
+// 随机凸多边形：三角形或按角度排序的四边形，坐标范围按 spread 选取 (含部分/完全在屏幕外的情况)
+static int Random_Polygon(Point2D *pts, int spread)
+{
+    int cx = rand() % (MLCD_WIDTH + 2 * spread) - spread;
+    int cy = rand() % (MLCD_HEIGHT + 2 * spread) - spread;
+    int n = 3 + (rand() & 1);
+    if (n == 3) {
+        for (int k = 0; k < 3; k++) {
+            pts[k].x = cx + rand() % (2 * spread + 1) - spread;
+            pts[k].y = cy + rand() % (2 * spread + 1) - spread;
+        }
+        return 3;
+    }
+
+    // 四边形：四个象限各取一个点，按逆时针排列即为凸 (退化时可能共线)
+    static const int sx[4] = {1, -1, -1, 1}, sy[4] = {1, 1, -1, -1};
+    for (int k = 0; k < 4; k++) {
+        pts[k].x = cx + sx[k] * (rand() % (spread + 1));
+        pts[k].y = cy + sy[k] * (rand() % (spread + 1));
+    }
+    return 4;
+}
+
+int main(void)
+{
+    static uint8_t ref[MLCD_HEIGHT * ROW_BYTES];
+    uint8_t *fb = MLCD_GetBufferPtr();
+    static const int spreads[] = {1, 4, 16, 64, 200};
+    long polygons = 0, mismatches = 0;
+
+    srand(5);
+    for (int i = 0; i < 200000; i++) {
+        // 帧缓冲预置随机内容，检查跨度之外的像素保持不变
+        if ((i & 63) == 0) {
+            for (int b = 0; b < MLCD_HEIGHT * ROW_BYTES; b++) fb[b] = (uint8_t)rand();
+        }
+        memcpy(ref, fb, sizeof(ref));
+
+        Point2D pts[4];
+        int n = Random_Polygon(pts, spreads[rand() % 5]);
+        int density = rand() % 17;
+
+        Raster_FillConvex(pts, n, (uint8_t)density);
+        Ref_FillConvex(ref, pts, n, density);
+        polygons++;
+
+        if (memcmp(ref, fb, sizeof(ref)) != 0) {
+            if (mismatches < 5) {
+                printf("mismatch: n=%d density=%d", n, density);
+                for (int k = 0; k < n; k++) printf(" (%d,%d)", pts[k].x, pts[k].y);
+                printf("\n");
+            }
+            mismatches++;
+            memcpy(fb, ref, sizeof(ref));
+        }
+    }
+
+    printf("%ld polygons, %ld mismatches\n", polygons, mismatches);
+    return mismatches ? 1 : 0;
+}
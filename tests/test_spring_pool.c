@@ -0,0 +1,198 @@
+//
+// 弹簧池：状态转移矩阵与双精度解析解比对，按帧间隔解析推进的轨迹与解析解比对，矩阵缓存，参数组共用与引用计数
+// 白盒测试：直接包含 animation.c (SPRING_POOL_FIXED 由构建目标指定，定点与 float 后端各编译一次)
+//
+
+#include "../Src/animation.c"
+#include <stdio.h>
+
+// 允许的轨迹误差 (px)：主要来自静止阈值处的吸附，定点后端另有每帧的矩阵量化误差
+#if SPRING_POOL_FIXED
+#define TRAJECTORY_TOLERANCE 0.05
+#else
+#define TRAJECTORY_TOLERANCE 0.02
+#endif
+
+static int failures;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } \
+    } while (0)
+
+/**
+ * @brief 参考解 (double)：x'' + c x' + k x = 0 从 (x0, v0) 出发经过 t 秒后的位移与速度
+ * 直接按教科书的三种情况写出，不经过被测的 Spring_Transition
+ */
+static void Ref_Spring(double k, double c, double x0, double v0, double t, double *x, double *v)
+{
+    double a = c / 2.0;
+    double disc = a * a - k;
+
+    if (fabs(disc) <= 1e-9 * k) {
+        // 临界阻尼：x = e^{-at} (x0 + C t)，C = v0 + a x0
+        double e = exp(-a * t), C = v0 + a * x0;
+        *x = e * (x0 + C * t);
+        *v = e * (C - a * (x0 + C * t));
+    } else if (disc < 0.0) {
+        // 欠阻尼：x = e^{-at} (x0 cos wd t + B sin wd t)，B = (v0 + a x0) / wd
+        double wd = sqrt(-disc), e = exp(-a * t), B = (v0 + a * x0) / wd;
+        double cs = cos(wd * t), sn = sin(wd * t);
+        *x = e * (x0 * cs + B * sn);
+        *v = e * ((B * wd - a * x0) * cs - (x0 * wd + a * B) * sn);
+    } else {
+        // 过阻尼：x = A e^{r1 t} + B e^{r2 t}，A + B = x0，r1 A + r2 B = v0
+        double r1 = -a + sqrt(disc), r2 = -a - sqrt(disc);
+        double A = (v0 - r2 * x0) / (r1 - r2), B = x0 - A;
+        *x = A * exp(r1 * t) + B * exp(r2 * t);
+        *v = A * r1 * exp(r1 * t) + B * r2 * exp(r2 * t);
+    }
+}
+
+static double Exact_Displacement(double k, double c, double x0, double v0, double t)
+{
+    double x, v;
+    Ref_Spring(k, c, x0, v0, t, &x, &v);
+    return x;
+}
+
+/**
+ * @brief Spring_Transition 的四个矩阵元素与参考解比对
+ * M 的两列分别是 (1, 0) 与 (0, 1) 出发的状态；临界阻尼附近 (zeta 在 0.999 ~ 1.001) 被测实现按临界阻尼近似
+ */
+static void Test_Transition(float k, float c)
+{
+    static const float dts[] = {1.0f / 240, 1.0f / 60, 0.1f, 0.25f, 1.0f};
+    double max_err = 0.0;
+    for (size_t i = 0; i < sizeof(dts) / sizeof(dts[0]); i++) {
+        float m[4];
+        double x, v;
+        Spring_Transition(k, c, dts[i], m);
+
+        Ref_Spring(k, c, 1.0, 0.0, dts[i], &x, &v);
+        double e0 = fmax(fabs(m[0] - x), fabs(m[2] - v) / sqrt(k));
+        Ref_Spring(k, c, 0.0, 1.0, dts[i], &x, &v);
+        double e1 = fmax(fabs(m[1] - x) * sqrt(k), fabs(m[3] - v));
+        // 速度与位移按固有频率换算到同一量纲后比较
+        double e = fmax(e0, e1);
+        if (e > max_err) max_err = e;
+    }
+    printf("transition k %5.1f c %5.2f (zeta %.4f): max error %.2e\n", k, c, c / (2.0 * sqrt(k)), max_err);
+    // float 精度约 1e-7；临界近似区间内允许近似本身的误差
+    double zeta = c / (2.0 * sqrt(k));
+    double tolerance = (fabs(zeta - 1.0) <= 0.001) ? 1e-3 : 1e-5;
+    CHECK(max_err < tolerance, "k %.1f c %.2f: transition error %.2e", k, c, max_err);
+}
+
+/**
+ * @brief 用抖动的帧间隔推进弹簧，与解析解比对
+ * 每帧推进的时间是量化后的帧间隔，对应时间比真实时间晚不足一档 (1 / SPRING_POOL_DT_RES)
+ */
+static void Test_Trajectory(float k, float c, float from, float to)
+{
+    SpringId_t id = Animation_SpringPool_Add(from, k, c);
+    CHECK(id != SPRING_INVALID, "pool full");
+    Animation_SpringPool_SetTarget(id, to);
+
+    double t = 0.0, max_err = 0.0;
+    for (int frame = 0; frame < 1000 && Animation_SpringPool_IsActive(id); frame++) {
+        float dt = 0.005f + (rand() % 3500) * 1e-5f; // 5 ~ 40 ms
+        // 实际推进的时间 = 帧间隔 + 上一帧余量 - 本帧余量
+        float before = spring_pool.dt_remainder;
+        Animation_SpringPool_Update(dt);
+        t += (double)before + dt - spring_pool.dt_remainder;
+
+        double expect = to + Exact_Displacement(k, c, from - to, 0.0, t);
+        double err = fabs(Animation_SpringPool_GetPosition(id) - expect);
+        if (err > max_err) max_err = err;
+    }
+    printf("k %5.1f c %4.1f: max error %.4f px\n", k, c, max_err);
+    CHECK(max_err < TRAJECTORY_TOLERANCE, "k %.1f c %.1f: trajectory error %.4f", k, c, max_err);
+    CHECK(!Animation_SpringPool_IsActive(id), "k %.1f c %.1f: did not settle", k, c);
+    CHECK(Animation_SpringPool_GetPosition(id) == to, "settled position %f != %f",
+          Animation_SpringPool_GetPosition(id), to);
+    Animation_SpringPool_Remove(id);
+}
+
+// 相同参数的弹簧共用参数组，修改/释放后引用计数正确
+static void Test_ParamSets(void)
+{
+    SpringId_t a = Animation_SpringPool_Add(0.0f, 100.0f, 12.0f);
+    SpringId_t b = Animation_SpringPool_Add(0.0f, 100.0f, 12.0f);
+    SpringId_t c = Animation_SpringPool_Add(0.0f, 60.0f, 10.0f);
+    int pa = spring_pool.params[a], pc = spring_pool.params[c];
+    CHECK(spring_pool.params[b] == pa, "equal parameters use separate sets");
+    CHECK(pc != pa, "different parameters share a set");
+    CHECK(spring_pool.param_refs[pa] == 2 && spring_pool.param_refs[pc] == 1, "refs %d %d",
+          spring_pool.param_refs[pa], spring_pool.param_refs[pc]);
+
+    Animation_SpringPool_SetParams(b, 60.0f, 10.0f);
+    CHECK(spring_pool.params[b] == pc, "SetParams did not join the existing set");
+    CHECK(spring_pool.param_refs[pa] == 1 && spring_pool.param_refs[pc] == 2, "refs after SetParams");
+
+    Animation_SpringPool_Remove(a);
+    CHECK(spring_pool.param_refs[pa] == 0, "set not released");
+    Animation_SpringPool_Remove(b);
+    Animation_SpringPool_Remove(c);
+    CHECK(spring_pool.param_refs[pc] == 0, "set not released");
+
+    // 池满时每个弹簧各占一组也不会用尽
+    SpringId_t ids[SPRING_POOL_SIZE];
+    for (int i = 0; i < SPRING_POOL_SIZE; i++) ids[i] = Animation_SpringPool_Add(0.0f, 10.0f + i, 1.0f);
+    for (int i = 0; i < SPRING_POOL_SIZE; i++) {
+        CHECK(ids[i] != SPRING_INVALID, "pool full at %d", i);
+        Animation_SpringPool_SetParams(ids[i], 20.0f + i, 2.0f);
+        CHECK(spring_pool.stiffness[spring_pool.params[ids[i]]] == 20.0f + i, "wrong set after SetParams");
+    }
+    for (int i = 0; i < SPRING_POOL_SIZE; i++) Animation_SpringPool_Remove(ids[i]);
+}
+
+// 转移矩阵按参数组和量化帧间隔缓存：同档帧间隔不重算，帧间隔变化时重算
+static void Test_MatrixCache(void)
+{
+    SpringId_t a = Animation_SpringPool_Add(0.0f, 100.0f, 12.0f);
+    SpringId_t b = Animation_SpringPool_Add(10.0f, 100.0f, 12.0f);
+    Animation_SpringPool_SetTarget(a, 100.0f);
+    Animation_SpringPool_SetTarget(b, 100.0f);
+    int p = spring_pool.params[a];
+    CHECK(spring_pool.matrix_ticks[p] == 0, "matrix computed before first update");
+
+    spring_pool.dt_remainder = 0.0f;
+    Animation_SpringPool_Update(16.0f / SPRING_POOL_DT_RES);
+    CHECK(spring_pool.matrix_ticks[p] == 16, "matrix ticks %d != 16", spring_pool.matrix_ticks[p]);
+    spring_t m01 = spring_pool.m01[p];
+    spring_pool.m01[p] = 0; // 若被重算会被覆盖回原值
+    Animation_SpringPool_Update(16.0f / SPRING_POOL_DT_RES);
+    CHECK(spring_pool.m01[p] == 0, "matrix recomputed for an unchanged dt");
+    spring_pool.m01[p] = m01;
+
+    Animation_SpringPool_Update(32.0f / SPRING_POOL_DT_RES);
+    CHECK(spring_pool.matrix_ticks[p] == 32, "matrix not recomputed for a new dt");
+
+    // 掉帧时也只推进一次，余量保留到下一帧
+    Animation_SpringPool_Update(0.25f + 0.5f / SPRING_POOL_DT_RES);
+    CHECK(spring_pool.matrix_ticks[p] == SPRING_POOL_DT_RES / 4, "long frame ticks %d", spring_pool.matrix_ticks[p]);
+    CHECK(spring_pool.dt_remainder > 0.0f && spring_pool.dt_remainder < 1.0f / SPRING_POOL_DT_RES,
+          "remainder %g", spring_pool.dt_remainder);
+
+    Animation_SpringPool_Remove(a);
+    Animation_SpringPool_Remove(b);
+}
+
+int main(void)
+{
+    srand(5);
+    Test_ParamSets();
+    Test_MatrixCache();
+    Test_Transition(100.0f, 12.0f);  // 欠阻尼
+    Test_Transition(100.0f, 19.95f); // 欠阻尼 (zeta 0.9975，在临界近似区间之外)
+    Test_Transition(25.0f, 10.0f);   // 临界阻尼
+    Test_Transition(25.0f, 10.009f); // 临界近似区间内 (zeta 1.0009)
+    Test_Transition(16.0f, 20.0f);   // 过阻尼
+    Test_Transition(400.0f, 60.0f);  // 过阻尼 (刚性)
+    Test_Trajectory(100.0f, 12.0f, 0.0f, 100.0f);  // 菜单光标 (欠阻尼)
+    Test_Trajectory(60.0f, 10.0f, 120.0f, -40.0f); // 菜单滚动 (欠阻尼)
+    Test_Trajectory(25.0f, 10.0f, 0.0f, 64.0f);    // 临界阻尼
+    Test_Trajectory(16.0f, 20.0f, 0.0f, -64.0f);   // 过阻尼
+    printf("%d failures\n", failures);
+    return failures != 0;
+}
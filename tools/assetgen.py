@@ -0,0 +1,356 @@
+#!/usr/bin/env python3
+"""
+Bitmap asset compiler for the MLCD driver.
+
+Turns every PBM (P1/P4) or PNG file in a directory into a const,
+flash-resident MLCD_Asset_t in framebuffer bit order (row-major, bit 0 =
+leftmost pixel, 1 = ink), so it can be drawn with MLCD_BlitMask without any
+bit-order conversion at runtime. Optionally emits pre-scaled variants for a
+contiguous range of widths (the carousel fish-eye sizes), so scaled drawing
+is also a plain blit.
+
+With --compress each bitmap is stored run-length encoded (MLCD_ENC_RLE)
+whenever that is smaller than the raw rows: pixels are read row-major as
+one stream of alternating runs starting with colour 0, and each run length
+is written as 4-bit nibbles (high nibble first) that are summed until a
+nibble below 15 is read. MLCD_DrawImage decodes it row by row.
+
+With --images every PBM/PNG in another directory becomes a plain
+MLCD_Bitmap_t without scaled variants (full-screen splash images, drawn with
+MLCD_DrawImage or streamed straight to the panel with MLCD_StreamImage).
+
+With --sprites every PBM/PNG in a second directory is compiled into an
+MLCD_Sprite_t frame sequence. A sheet is a horizontal strip of equally sized
+frames: square (frame width = sheet height) unless the file name ends in
+"@<width>", e.g. "loading@64.png". Each frame after the first is stored as
+the XOR against the previous frame (MLCD_FRAME_DELTA) when that encodes
+smaller. PNG sheets with transparent pixels also get a per-frame opacity
+mask (identical masks are shared).
+
+PBM input needs no third-party modules; PNG input needs Pillow. For PNG a
+pixel is ink when it is opaque (alpha >= 128) and dark (luma < 128).
+
+Usage:
+    assetgen.py --input assets/icons --prefix icon --scale 25 38 \
+                --images assets/images --sprites assets/sprites --frame-ms 60 \
+                --out-c Src/mlcd_assets.c --out-h Inc/mlcd_assets.h
+"""
+
+import argparse
+import os
+import re
+
+
+def read_pbm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    magic = data[:2]
+    if magic not in (b"P1", b"P4"):
+        raise ValueError("%s: not a PBM file" % path)
+
+    # Header tokens: magic, width, height (comments start with '#')
+    pos, tokens = 2, []
+    while len(tokens) < 2:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(int(data[start:pos]))
+    w, h = tokens
+
+    if magic == b"P1":
+        body = re.sub(rb"#[^\n]*", b"", data[pos:])
+        bits = [c == ord("1") for c in body if c in b"01"]
+        if len(bits) < w * h:
+            raise ValueError("%s: truncated pixel data" % path)
+        return w, h, [bits[y * w:(y + 1) * w] for y in range(h)]
+
+    pos += 1  # single whitespace before raster
+    row_bytes = (w + 7) // 8
+    rows = []
+    for y in range(h):
+        row = data[pos + y * row_bytes:pos + (y + 1) * row_bytes]
+        rows.append([bool(row[x >> 3] & (0x80 >> (x & 7))) for x in range(w)])
+    return w, h, rows
+
+
+def read_png(path, with_mask=False):
+    from PIL import Image  # only needed for PNG input
+
+    img = Image.open(path).convert("RGBA")
+    w, h = img.size
+    px = img.load()
+    rows, mask = [], []
+    for y in range(h):
+        row, mrow = [], []
+        for x in range(w):
+            r, g, b, a = px[x, y]
+            luma = (r * 299 + g * 587 + b * 114) // 1000
+            row.append(a >= 128 and luma < 128)
+            mrow.append(a >= 128)
+        rows.append(row)
+        mask.append(mrow)
+    if with_mask:
+        return w, h, rows, (None if all(all(m) for m in mask) else mask)
+    return w, h, rows
+
+
+def scale_nearest(w, h, rows, new_w):
+    """Nearest-neighbour scale to new_w, keeping the aspect ratio."""
+    new_h = max(1, (h * new_w + w // 2) // w)
+    return new_w, new_h, [[rows[y * h // new_h][x * w // new_w] for x in range(new_w)]
+                          for y in range(new_h)]
+
+
+def pack(w, h, rows):
+    """Pack to framebuffer bit order: row-major, bit 0 = leftmost pixel."""
+    stride = (w + 7) // 8
+    out = []
+    for row in rows:
+        packed = [0] * stride
+        for x, on in enumerate(row):
+            if on:
+                packed[x >> 3] |= 1 << (x & 7)
+        out.extend(packed)
+    return stride, out
+
+
+def rle_encode(w, h, rows):
+    """MLCD_ENC_RLE: alternating pixel runs (starting with 0), 4-bit nibbles."""
+    nibbles, color, run = [], False, 0
+    for row in rows:
+        for on in row:
+            if on == color:
+                run += 1
+            else:
+                nibbles += [15] * (run // 15) + [run % 15]
+                color, run = on, 1
+    nibbles += [15] * (run // 15) + [run % 15]
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def encode(w, h, rows, compress):
+    """Return (stride, data, encoding) using the smaller representation."""
+    stride, raw = pack(w, h, rows)
+    if compress:
+        rle = rle_encode(w, h, rows)
+        if len(rle) < len(raw):
+            return stride, rle, "MLCD_ENC_RLE"
+    return stride, raw, "MLCD_ENC_RAW"
+
+
+def emit_bytes(lines, name, data, comment):
+    lines.append("static const uint8_t %s[%d] = { // %s" % (name, len(data), comment))
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+
+
+def crop(rows, x0, w):
+    return [row[x0:x0 + w] for row in rows]
+
+
+def compile_sprite(c_out, h_out, path, prefix, frame_ms, compress):
+    """Emit an MLCD_Sprite_t; returns (encoded bytes, uncompressed bytes)."""
+    fname = os.path.basename(path)
+    stem = os.path.splitext(fname)[0]
+    if fname.lower().endswith(".png"):
+        sheet_w, h, sheet, sheet_mask = read_png(path, with_mask=True)
+    else:
+        (sheet_w, h, sheet), sheet_mask = read_pbm(path), None
+
+    fw = h
+    if "@" in stem:
+        stem, fw = stem.rsplit("@", 1)
+        fw = int(fw)
+    if fw <= 0 or sheet_w % fw:
+        raise ValueError("%s: sheet width %d is not a multiple of frame width %d" % (path, sheet_w, fw))
+    count = sheet_w // fw
+    sym = "%s_%s" % (prefix, re.sub(r"\W", "_", stem).lower())
+    stride = (fw + 7) // 8
+
+    frames, masks, total_out, prev = [], {}, 0, None
+    for i in range(count):
+        rows = crop(sheet, i * fw, fw)
+        fstride, data, enc = encode(fw, h, rows, compress)
+        kind = "key"
+        if prev is not None:
+            delta = [[a != b for a, b in zip(ra, rb)] for ra, rb in zip(rows, prev)]
+            _, ddata, denc = encode(fw, h, delta, compress)
+            if len(ddata) < len(data):
+                data, enc, kind = ddata, denc, "delta"
+        prev = rows
+        name = "%s_f%d" % (sym, i)
+        emit_bytes(c_out, name, data, "frame %d, %dx%d, %s, %s" % (i, fw, h, kind, enc))
+        total_out += len(data)
+
+        mask_ref = "NULL"
+        if sheet_mask is not None:
+            mrows = crop(sheet_mask, i * fw, fw)
+            key = tuple(tuple(r) for r in mrows)
+            if key not in masks:
+                _, mdata, menc = encode(fw, h, mrows, compress)
+                mname = "%s_mask%d" % (sym, len(masks))
+                emit_bytes(c_out, mname + "_data", mdata, "mask, %dx%d, %s" % (fw, h, menc))
+                c_out.append("static const MLCD_Bitmap_t %s = {%s_data, %d, %d, %d, %s};"
+                             % (mname, mname, fw, h, stride, menc))
+                c_out.append("")
+                masks[key] = mname
+                total_out += len(mdata)
+            mask_ref = "&" + masks[key]
+        frames.append((name, enc, mask_ref, kind))
+
+    has_delta = any(kind == "delta" for _, _, _, kind in frames)
+    c_out.append("static const MLCD_Frame_t %s_frames[%d] = {" % (sym, count))
+    for name, enc, mask_ref, kind in frames:
+        c_out.append("    {{%s, %d, %d, %d, %s}, %s, %s}," % (
+            name, fw, h, stride, enc, mask_ref, "MLCD_FRAME_DELTA" if kind == "delta" else "0"))
+    c_out.append("};")
+    c_out.append("")
+    c_out.append("const MLCD_Sprite_t %s = {" % sym)
+    c_out.append("    .frames = %s_frames," % sym)
+    c_out.append("    .frame_count = %d," % count)
+    c_out.append("    .frame_ms = %d," % frame_ms)
+    c_out.append("    .w = %d, .h = %d, .stride = %d," % (fw, h, stride))
+    c_out.append("    .has_delta = %d," % has_delta)
+    c_out.append("};")
+    c_out.append("")
+
+    upper = sym.upper()
+    h_out.append("#define %s_W      %d" % (upper, fw))
+    h_out.append("#define %s_H      %d" % (upper, h))
+    h_out.append("#define %s_STRIDE %d" % (upper, stride))
+    h_out.append("#define %s_FRAMES %d" % (upper, count))
+    h_out.append("extern const MLCD_Sprite_t %s;" % sym)
+    h_out.append("")
+
+    raw = count * stride * h * (2 if sheet_mask is not None else 1)
+    return total_out, raw
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("--input", required=True, help="directory with .pbm/.png files")
+    ap.add_argument("--prefix", default="asset", help="symbol prefix, e.g. 'icon'")
+    ap.add_argument("--scale", type=int, nargs=2, metavar=("MIN_W", "MAX_W"),
+                    help="also emit variants for every width in [MIN_W, MAX_W]")
+    ap.add_argument("--compress", action="store_true", help="store bitmaps as MLCD_ENC_RLE when smaller")
+    ap.add_argument("--images", help="directory with unscaled images (e.g. splash screens)")
+    ap.add_argument("--image-prefix", default="image", help="symbol prefix for images")
+    ap.add_argument("--sprites", help="directory with sprite sheets (horizontal frame strips)")
+    ap.add_argument("--sprite-prefix", default="sprite", help="symbol prefix for sprites")
+    ap.add_argument("--frame-ms", type=int, default=50, help="sprite frame duration in ms")
+    ap.add_argument("--out-c", required=True)
+    ap.add_argument("--out-h", required=True)
+    args = ap.parse_args()
+
+    files = sorted(f for f in os.listdir(args.input) if f.lower().endswith((".pbm", ".png")))
+    header_name = os.path.basename(args.out_h)
+    guard = "MLCD_DRIVER_" + header_name.upper().replace(".", "_")
+    banner = [
+        "//",
+        "// Generated by tools/assetgen.py - do not edit.",
+        "// Source: %s/" % args.input.replace("\\", "/").rstrip("/"),
+    ] + ([
+        "// Images: %s/" % args.images.replace("\\", "/").rstrip("/"),
+    ] if args.images else []) + ([
+        "// Sprites: %s/" % args.sprites.replace("\\", "/").rstrip("/"),
+    ] if args.sprites else []) + [
+        "//",
+        "",
+    ]
+
+    h_out = banner + ["#ifndef " + guard, "#define " + guard, "", '#include "mlcd.h"', ""]
+    c_out = banner + ['#include "%s"' % header_name, ""]
+
+    total_raw = total_out = 0
+    for fname in files:
+        path = os.path.join(args.input, fname)
+        stem = re.sub(r"\W", "_", os.path.splitext(fname)[0]).lower()
+        sym = "%s_%s" % (args.prefix, stem)
+        w, h, rows = (read_png if fname.lower().endswith(".png") else read_pbm)(path)
+
+        stride, data, enc = encode(w, h, rows, args.compress)
+        emit_bytes(c_out, sym + "_data", data, "%dx%d, stride %d, %s" % (w, h, stride, enc))
+        total_raw += stride * h
+        total_out += len(data)
+
+        variants = []
+        if args.scale:
+            for sw in range(args.scale[0], args.scale[1] + 1):
+                vw, vh, vrows = scale_nearest(w, h, rows, sw)
+                vstride, vdata, venc = encode(vw, vh, vrows, args.compress)
+                vsym = "%s_data_%d" % (sym, sw)
+                emit_bytes(c_out, vsym, vdata, "%dx%d, stride %d, %s" % (vw, vh, vstride, venc))
+                variants.append((vw, vh, vstride, vsym, venc))
+                total_raw += vstride * vh
+                total_out += len(vdata)
+
+            c_out.append("static const MLCD_Bitmap_t %s_scaled[%d] = {" % (sym, len(variants)))
+            for vw, vh, vstride, vsym, venc in variants:
+                c_out.append("    {%s, %d, %d, %d, %s}," % (vsym, vw, vh, vstride, venc))
+            c_out.append("};")
+            c_out.append("")
+
+        c_out.append("const MLCD_Asset_t %s = {" % sym)
+        c_out.append("    .base = {%s_data, %d, %d, %d, %s}," % (sym, w, h, stride, enc))
+        c_out.append("    .scaled = %s," % ("%s_scaled" % sym if variants else "NULL"))
+        c_out.append("    .scaled_count = %d," % len(variants))
+        c_out.append("};")
+        c_out.append("")
+
+        upper = sym.upper()
+        h_out.append("#define %s_W      %d" % (upper, w))
+        h_out.append("#define %s_H      %d" % (upper, h))
+        h_out.append("#define %s_STRIDE %d" % (upper, stride))
+        h_out.append("extern const MLCD_Asset_t %s;" % sym)
+        h_out.append("")
+
+    if args.images:
+        images = sorted(f for f in os.listdir(args.images) if f.lower().endswith((".pbm", ".png")))
+        for fname in images:
+            stem = re.sub(r"\W", "_", os.path.splitext(fname)[0]).lower()
+            sym = "%s_%s" % (args.image_prefix, stem)
+            path = os.path.join(args.images, fname)
+            w, h, rows = (read_png if fname.lower().endswith(".png") else read_pbm)(path)
+            stride, data, enc = encode(w, h, rows, args.compress)
+            emit_bytes(c_out, sym + "_data", data, "%dx%d, stride %d, %s" % (w, h, stride, enc))
+            c_out.append("const MLCD_Bitmap_t %s = {%s_data, %d, %d, %d, %s};" % (sym, sym, w, h, stride, enc))
+            c_out.append("")
+            total_raw += stride * h
+            total_out += len(data)
+
+            upper = sym.upper()
+            h_out.append("#define %s_W      %d" % (upper, w))
+            h_out.append("#define %s_H      %d" % (upper, h))
+            h_out.append("#define %s_STRIDE %d" % (upper, stride))
+            h_out.append("extern const MLCD_Bitmap_t %s;" % sym)
+            h_out.append("")
+
+    if args.sprites:
+        sheets = sorted(f for f in os.listdir(args.sprites) if f.lower().endswith((".pbm", ".png")))
+        for fname in sheets:
+            out, raw = compile_sprite(c_out, h_out, os.path.join(args.sprites, fname),
+                                      args.sprite_prefix, args.frame_ms, args.compress)
+            total_out += out
+            total_raw += raw
+
+    h_out += ["// Bitmap data: %d bytes (%d uncompressed)" % (total_out, total_raw), ""]
+    h_out += ["#endif //" + guard, ""]
+
+    with open(args.out_h, "w", newline="\n") as f:
+        f.write("\n".join(h_out))
+    with open(args.out_c, "w", newline="\n") as f:
+        f.write("\n".join(c_out))
+
+
+if __name__ == "__main__":
+    main()
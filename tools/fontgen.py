@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Dithered font generator for the MLCD driver.
+
+Renders each ASCII glyph of a TTF at 4x the target size and box-filters every
+4x4 block down to a coverage value, stored as 4 bits per pixel (0 = empty,
+15 = fully covered). The glyphs are emitted in the compact MLCD_Glyph_t
+format (row-major, low nibble = left pixel, cropped to the ink box).
+MLCD_DrawStringFont turns coverage into pixels with a 4x4 Bayer threshold
+taken from screen coordinates, so the dither pattern stays fixed on screen
+instead of moving with each glyph.
+
+Output is deterministic for a given TTF, size list and Pillow version.
+
+Usage:
+    fontgen.py --ttf Lato-Regular.ttf --sizes 12 16 --name aa \
+               --out-c Src/mlcd_font_aa.c --out-h Inc/mlcd_font_aa.h
+"""
+
+import argparse
+import os
+
+from PIL import Image, ImageDraw, ImageFont
+
+OVERSAMPLE = 4
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+
+COVERAGE_MAX = 15  # 4-bit coverage levels
+
+
+def render_glyph(font, ch, line_h, pad):
+    """Return (x_ofs, y_ofs, w, h, advance, rows) for one character."""
+    advance = int(round(font.getlength(ch) / OVERSAMPLE))
+    cells_w = advance + 2 * pad
+    img = Image.new("L", (cells_w * OVERSAMPLE, line_h * OVERSAMPLE), 0)
+    ImageDraw.Draw(img).text((pad * OVERSAMPLE, 0), ch, font=font, fill=255, anchor="la")
+    px = img.load()
+
+    full = 255 * OVERSAMPLE * OVERSAMPLE
+    cov = [[0] * cells_w for _ in range(line_h)]
+    for gy in range(line_h):
+        for gx in range(cells_w):
+            total = 0
+            for sy in range(OVERSAMPLE):
+                for sx in range(OVERSAMPLE):
+                    total += px[gx * OVERSAMPLE + sx, gy * OVERSAMPLE + sy]
+            cov[gy][gx] = (total * COVERAGE_MAX + full // 2) // full
+
+    xs = [x for y in range(line_h) for x in range(cells_w) if cov[y][x]]
+    ys = [y for y in range(line_h) for x in range(cells_w) if cov[y][x]]
+    if not xs:
+        return 0, 0, 0, 0, advance, []
+
+    x0, x1, y0, y1 = min(xs), max(xs), min(ys), max(ys)
+    w, h = x1 - x0 + 1, y1 - y0 + 1
+    stride = (w + 1) // 2
+    rows = []
+    for y in range(y0, y1 + 1):
+        row = [0] * stride
+        for x in range(x0, x1 + 1):
+            i = x - x0
+            row[i >> 1] |= cov[y][x] << ((i & 1) * 4)  # low nibble = left pixel
+        rows.append(row)
+    return x0 - pad, y0, w, h, advance, rows
+
+
+def build_font(ttf, size):
+    font = ImageFont.truetype(ttf, size * OVERSAMPLE)
+    ascent, descent = font.getmetrics()
+    line_h = (ascent + descent + OVERSAMPLE - 1) // OVERSAMPLE
+    glyphs, bitmap = [], []
+    for code in range(FIRST_CHAR, LAST_CHAR + 1):
+        x_ofs, y_ofs, w, h, adv, rows = render_glyph(font, chr(code), line_h, size)
+        glyphs.append((len(bitmap), w, h, x_ofs, y_ofs, adv, chr(code)))
+        for row in rows:
+            bitmap.extend(row)
+    return line_h, glyphs, bitmap
+
+
+def c_char_comment(ch):
+    return {"\\": "backslash", "*": "asterisk", "/": "slash"}.get(ch, ch)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("--ttf", required=True)
+    ap.add_argument("--sizes", type=int, nargs="+", required=True)
+    ap.add_argument("--name", default="aa")
+    ap.add_argument("--out-c", required=True)
+    ap.add_argument("--out-h", required=True)
+    args = ap.parse_args()
+
+    header_name = os.path.basename(args.out_h)
+    guard = "MLCD_DRIVER_" + header_name.upper().replace(".", "_")
+    ttf_name = os.path.basename(args.ttf)
+    banner = [
+        "//",
+        "// Generated by tools/fontgen.py - do not edit.",
+        "// Source: %s, sizes: %s, %dx oversampled, 4-bit coverage." % (
+            ttf_name, " ".join(str(s) for s in args.sizes), OVERSAMPLE),
+        "//",
+        "",
+    ]
+
+    h_out = banner + ["#ifndef " + guard, "#define " + guard, "", '#include "mlcd.h"', ""]
+    c_out = banner + ['#include "%s"' % header_name, ""]
+
+    for size in args.sizes:
+        sym = "mlcd_font_%s%d" % (args.name, size)
+        line_h, glyphs, bitmap = build_font(args.ttf, size)
+        h_out.append("extern const MLCD_FontDesc_t %s; // line height %d px" % (sym, line_h))
+
+        c_out.append("static const uint8_t %s_bitmap[%d] = {" % (sym, max(len(bitmap), 1)))
+        for i in range(0, len(bitmap), 16):
+            c_out.append("    " + ", ".join("0x%02X" % b for b in bitmap[i:i + 16]) + ",")
+        if not bitmap:
+            c_out.append("    0x00")
+        c_out.append("};")
+        c_out.append("")
+        c_out.append("static const MLCD_Glyph_t %s_glyphs[%d] = {" % (sym, len(glyphs)))
+        for off, w, h, xo, yo, adv, ch in glyphs:
+            c_out.append("    {%5d, %2d, %2d, %3d, %3d, %2d}, // '%s'" % (
+                off, w, h, xo, yo, adv, c_char_comment(ch)))
+        c_out.append("};")
+        c_out.append("")
+        c_out.append("const MLCD_FontDesc_t %s = {" % sym)
+        c_out.append("    .bitmap = %s_bitmap," % sym)
+        c_out.append("    .glyphs = %s_glyphs," % sym)
+        c_out.append("    .first = 0x%02X," % FIRST_CHAR)
+        c_out.append("    .last = 0x%02X," % LAST_CHAR)
+        c_out.append("    .height = %d," % line_h)
+        c_out.append("};")
+        c_out.append("")
+
+    h_out += ["", "#endif //" + guard, ""]
+
+    with open(args.out_h, "w", newline="\n") as f:
+        f.write("\n".join(h_out))
+    with open(args.out_c, "w", newline="\n") as f:
+        f.write("\n".join(c_out))
+
+
+if __name__ == "__main__":
+    main()
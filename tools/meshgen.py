@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+"""
+Wavefront OBJ to flash mesh compiler for the 3D demos.
+
+Turns every .obj file in a directory into a const, flash-resident Mesh_t
+(see Inc/mesh.h) so the renderer in animation.c needs no hard-coded vertex
+tables and no runtime preprocessing:
+
+  * Vertices are converted from OBJ axes (y up, z towards the viewer) to
+    screen axes (y down, z into the screen) - a 180 degree turn about x, so
+    winding is preserved - scaled so the largest coordinate is 1 and
+    quantized to int8 (unit = 127) or, with --precision 16, int16
+    (unit = 32767).
+  * Triangles and quads are kept; larger polygons are fan-triangulated.
+    Faces must be counter-clockwise seen from outside (the OBJ convention);
+    a mesh whose signed volume comes out negative is flipped as a whole.
+  * Each face gets an int8 outward unit normal (unit = 127, Newell's method).
+  * Edges are the unique face edges in order of first use, each with its two
+    adjacent faces for hidden-line removal; "l" elements add wire edges
+    without faces.
+  * Indices are uint8 when every count fits below 255, else uint16; the
+    all-ones value marks "none" (triangle 4th index, missing adjacent face).
+
+Usage:
+    meshgen.py --input assets/meshes --prefix mesh \
+               --out-c Src/mesh_assets.c --out-h Inc/mesh_assets.h
+"""
+
+import argparse
+import os
+import re
+
+
+def parse_obj(path):
+    """Return (vertices, faces, lines) with 0-based indices."""
+    verts, faces, lines = [], [], []
+
+    def index(tok):
+        i = int(tok.split("/")[0])
+        return i - 1 if i > 0 else len(verts) + i
+
+    with open(path) as f:
+        for raw in f:
+            parts = raw.split("#", 1)[0].split()
+            if not parts:
+                continue
+            if parts[0] == "v":
+                x, y, z = (float(t) for t in parts[1:4])
+                verts.append((x, -y, -z))  # OBJ axes -> screen axes
+            elif parts[0] == "f":
+                poly = [index(t) for t in parts[1:]]
+                if len(poly) <= 4:
+                    faces.append(poly)
+                else:
+                    for k in range(1, len(poly) - 1):
+                        faces.append([poly[0], poly[k], poly[k + 1]])
+            elif parts[0] == "l":
+                poly = [index(t) for t in parts[1:]]
+                lines += list(zip(poly, poly[1:]))
+    return verts, faces, lines
+
+
+def newell_normal(verts, face):
+    nx = ny = nz = 0.0
+    for k in range(len(face)):
+        ax, ay, az = verts[face[k]]
+        bx, by, bz = verts[face[(k + 1) % len(face)]]
+        nx += (ay - by) * (az + bz)
+        ny += (az - bz) * (ax + bx)
+        nz += (ax - bx) * (ay + by)
+    return nx, ny, nz
+
+
+def signed_volume(verts, faces):
+    vol = 0.0
+    for face in faces:
+        a = verts[face[0]]
+        for k in range(1, len(face) - 1):
+            b, c = verts[face[k]], verts[face[k + 1]]
+            vol += (a[0] * (b[1] * c[2] - b[2] * c[1])
+                    - a[1] * (b[0] * c[2] - b[2] * c[0])
+                    + a[2] * (b[0] * c[1] - b[1] * c[0]))
+    return vol / 6.0
+
+
+def build_edges(faces, lines):
+    edges, lookup = [], {}
+    for fi, face in enumerate(faces):
+        for k in range(len(face)):
+            a, b = face[k], face[(k + 1) % len(face)]
+            key = (min(a, b), max(a, b))
+            if key not in lookup:
+                lookup[key] = len(edges)
+                edges.append([a, b, fi, None])
+            else:
+                e = edges[lookup[key]]
+                if e[3] is None:
+                    e[3] = fi  # non-manifold edges keep their first two faces
+    for a, b in lines:
+        key = (min(a, b), max(a, b))
+        if key not in lookup:
+            lookup[key] = len(edges)
+            edges.append([a, b, None, None])
+    return edges
+
+
+def emit_array(lines, ctype, name, values, per_line):
+    lines.append("static const %s %s[%d] = {" % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    lines.append("")
+
+
+def compile_mesh(c_out, h_out, path, prefix, precision):
+    stem = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0]).lower()
+    sym = "%s_%s" % (prefix, stem)
+    verts, faces, lines = parse_obj(path)
+    if not verts:
+        raise SystemExit("%s: no vertices" % path)
+
+    if faces and signed_volume(verts, faces) < 0:
+        faces = [list(reversed(face)) for face in faces]
+
+    radius = max(abs(c) for v in verts for c in v) or 1.0
+    unit = 127 if precision == 8 else 32767
+    qverts = [int(round(c / radius * unit)) for v in verts for c in v]
+
+    normals = []
+    for face in faces:
+        nx, ny, nz = newell_normal(verts, face)
+        n = (nx * nx + ny * ny + nz * nz) ** 0.5 or 1.0
+        normals += [int(round(nx / n * 127)), int(round(ny / n * 127)), int(round(nz / n * 127))]
+
+    edges = build_edges(faces, lines)
+
+    index16 = max(len(verts), len(faces)) >= 255
+    none = 0xFFFF if index16 else 0xFF
+    itype = "uint16_t" if index16 else "uint8_t"
+    vtype = "int8_t" if precision == 8 else "int16_t"
+
+    edge_data = []
+    for a, b, fa, fb in edges:
+        edge_data += [a, b, none if fa is None else fa, none if fb is None else fb]
+    face_data = []
+    for face in faces:
+        face_data += face + [none] * (4 - len(face))
+
+    c_out.append("// %s: %d vertices, %d edges, %d faces, radius %g"
+                 % (os.path.basename(path), len(verts), len(edges), len(faces), radius))
+    emit_array(c_out, vtype, sym + "_vertices", qverts, 12)
+    if faces:
+        emit_array(c_out, "int8_t", sym + "_normals", normals, 12)
+        emit_array(c_out, itype, sym + "_faces", face_data, 16)
+    emit_array(c_out, itype, sym + "_edges", edge_data, 16)
+
+    flags = [f for f, on in (("MESH_VERT16", precision == 16), ("MESH_INDEX16", index16)) if on]
+    c_out.append("const Mesh_t %s = {" % sym)
+    c_out.append("    .vertices = %s_vertices," % sym)
+    c_out.append("    .normals = %s," % ("%s_normals" % sym if faces else "NULL"))
+    c_out.append("    .edges = %s_edges," % sym)
+    c_out.append("    .faces = %s," % ("%s_faces" % sym if faces else "NULL"))
+    c_out.append("    .vertex_count = %d," % len(verts))
+    c_out.append("    .edge_count = %d," % len(edges))
+    c_out.append("    .face_count = %d," % len(faces))
+    c_out.append("    .flags = %s," % (" | ".join(flags) if flags else "0"))
+    c_out.append("};")
+    c_out.append("")
+
+    upper = sym.upper()
+    h_out.append("#define %s_VERTICES %d" % (upper, len(verts)))
+    h_out.append("#define %s_EDGES    %d" % (upper, len(edges)))
+    h_out.append("#define %s_FACES    %d" % (upper, len(faces)))
+    h_out.append("extern const Mesh_t %s;" % sym)
+    h_out.append("")
+
+    isize = 2 if index16 else 1
+    size = (len(qverts) * (precision // 8) + len(normals)
+            + (len(edge_data) + len(face_data)) * isize)
+    return size, len(verts), len(faces)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("--input", required=True, help="directory with .obj files")
+    ap.add_argument("--prefix", default="mesh", help="symbol prefix")
+    ap.add_argument("--precision", type=int, choices=(8, 16), default=8,
+                    help="vertex quantization in bits")
+    ap.add_argument("--out-c", required=True)
+    ap.add_argument("--out-h", required=True)
+    args = ap.parse_args()
+
+    files = sorted(f for f in os.listdir(args.input) if f.lower().endswith(".obj"))
+    header_name = os.path.basename(args.out_h)
+    guard = "MLCD_DRIVER_" + header_name.upper().replace(".", "_")
+    banner = [
+        "//",
+        "// Generated by tools/meshgen.py - do not edit.",
+        "// Source: %s/" % args.input.replace("\\", "/").rstrip("/"),
+        "//",
+        "",
+    ]
+
+    h_out = banner + ["#ifndef " + guard, "#define " + guard, "", '#include "mesh.h"', ""]
+    c_out = banner + ['#include "%s"' % header_name, "", "#include <stddef.h>", ""]
+
+    total = max_verts = max_faces = 0
+    for fname in files:
+        size, nv, nf = compile_mesh(c_out, h_out, os.path.join(args.input, fname),
+                                    args.prefix, args.precision)
+        total += size
+        max_verts = max(max_verts, nv)
+        max_faces = max(max_faces, nf)
+
+    # The renderer sizes its per-frame scratch buffers from these
+    upper = args.prefix.upper()
+    h_out += ["// Largest mesh (renderer scratch buffer sizes)",
+              "#define %s_MAX_VERTICES %d" % (upper, max_verts),
+              "#define %s_MAX_FACES    %d" % (upper, max_faces),
+              "",
+              "// Mesh data: %d bytes" % total, ""]
+    h_out += ["#endif //" + guard, ""]
+
+    with open(args.out_h, "w", newline="\n") as f:
+        f.write("\n".join(h_out))
+    with open(args.out_c, "w", newline="\n") as f:
+        f.write("\n".join(c_out))
+
+
+if __name__ == "__main__":
+    main()